@@ -0,0 +1,88 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Gram matrix A^T * A: panelwise rank-k updates vs. column by column
+    matrix-vector products.
+*/
+
+#include <sstream>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    class GramMatrix
+    {
+        public:
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            explicit GramMatrix(const Eigen::MatrixXd &matrix) : matrix_(matrix)
+            {
+            }
+    };
+
+
+    class GramMatrixPanelwise : public GramMatrix
+    {
+        public:
+            explicit GramMatrixPanelwise(const Eigen::MatrixXd &matrix) : GramMatrix(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                result_.setZero(matrix_.cols(), matrix_.cols());
+                eigenut::addATAPanelwise(result_, matrix_);
+            }
+    };
+
+
+    class GramMatrixColumnwise : public GramMatrix
+    {
+        public:
+            explicit GramMatrixColumnwise(const Eigen::MatrixXd &matrix) : GramMatrix(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                eigenut::getATAColumnwise(result_, matrix_);
+            }
+    };
+}
+
+
+int main()
+{
+    // tall-skinny and square matrices
+    const std::ptrdiff_t sizes[][2] = { {1000, 10},
+                                        {5000, 30},
+                                        {10000, 100},
+                                        {50, 50},
+                                        {200, 200},
+                                        {800, 800} };
+
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(sizes[i][0], sizes[i][1]);
+
+        std::stringstream parameters;
+        parameters << "size=" << sizes[i][0] << "x" << sizes[i][1];
+
+        GramMatrixPanelwise panelwise(matrix);
+        benchmark::report("ata/panelwise", parameters.str(), benchmark::measure(panelwise));
+
+        GramMatrixColumnwise columnwise(matrix);
+        benchmark::report("ata/columnwise", parameters.str(), benchmark::measure(columnwise));
+    }
+
+    return (0);
+}
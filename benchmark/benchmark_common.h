@@ -0,0 +1,160 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief
+*/
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+#include <boost/timer/timer.hpp>
+
+
+namespace benchmark
+{
+    /**
+     * @brief Measures average wall time of a call of a functor.
+     *
+     * @tparam t_Functor functor with operator()()
+     *
+     * @param[in,out] functor
+     * @param[in] min_duration_ns   minimal total duration of measurements
+     *
+     * @return average duration of one call in nanoseconds
+     */
+    template<class t_Functor>
+        double measure(t_Functor &functor, const boost::timer::nanosecond_type min_duration_ns = 100000000)
+    {
+        // warm up
+        functor();
+
+        std::size_t num_calls = 0;
+        boost::timer::cpu_timer timer;
+        do
+        {
+            functor();
+            ++num_calls;
+        }
+        while (timer.elapsed().wall < min_duration_ns);
+
+        return (static_cast<double>(timer.elapsed().wall) / num_calls);
+    }
+
+
+    /**
+     * @brief Output format of results, selected by EIGENUT_BENCHMARK_FORMAT
+     * environment variable: "text" (default), "csv", or "json" (one JSON
+     * object per line).
+     */
+    class OutputFormat
+    {
+        public:
+            enum Type
+            {
+                TEXT = 0,
+                CSV = 1,
+                JSON = 2
+            };
+
+
+        public:
+            /**
+             * @brief Get output format.
+             *
+             * @return format
+             */
+            static Type get()
+            {
+                static const Type format = parse(std::getenv("EIGENUT_BENCHMARK_FORMAT"));
+                return (format);
+            }
+
+
+        protected:
+            static Type parse(const char *format)
+            {
+                if (NULL != format)
+                {
+                    if (0 == std::strcmp(format, "csv"))
+                    {
+                        return (CSV);
+                    }
+                    if (0 == std::strcmp(format, "json"))
+                    {
+                        return (JSON);
+                    }
+                }
+                return (TEXT);
+            }
+    };
+
+
+    /**
+     * @brief Prints a result of a measurement.
+     *
+     * @param[in] name          name of the benchmark
+     * @param[in] parameters    parameters of the benchmark
+     * @param[in] duration_ns   duration of a call
+     * @param[in] baseline_ns   duration of a call of the dense Eigen
+     *                          baseline, ignored if not positive
+     */
+    inline void report( const std::string &name,
+                        const std::string &parameters,
+                        const double duration_ns,
+                        const double baseline_ns = 0.0)
+    {
+        static bool header_printed = false;
+
+        switch (OutputFormat::get())
+        {
+            case OutputFormat::CSV:
+                if (false == header_printed)
+                {
+                    std::cout << "name,parameters,duration_ns,baseline_ns,speedup" << std::endl;
+                    header_printed = true;
+                }
+                std::cout << name << ",\"" << parameters << "\","
+                          << std::fixed << std::setprecision(1) << duration_ns << ",";
+                if (baseline_ns > 0.0)
+                {
+                    std::cout << baseline_ns << "," << std::setprecision(3) << baseline_ns / duration_ns;
+                }
+                else
+                {
+                    std::cout << ",";
+                }
+                std::cout << std::endl;
+                break;
+
+            case OutputFormat::JSON:
+                std::cout << "{\"name\": \"" << name << "\", \"parameters\": \"" << parameters << "\", "
+                          << std::fixed << std::setprecision(1) << "\"duration_ns\": " << duration_ns;
+                if (baseline_ns > 0.0)
+                {
+                    std::cout << ", \"baseline_ns\": " << baseline_ns
+                              << ", \"speedup\": " << std::setprecision(3) << baseline_ns / duration_ns;
+                }
+                std::cout << "}" << std::endl;
+                break;
+
+            default:
+                std::cout << std::left << std::setw(40) << name
+                          << std::setw(40) << parameters
+                          << std::right << std::fixed << std::setprecision(1) << std::setw(16) << duration_ns << " ns";
+                if (baseline_ns > 0.0)
+                {
+                    std::cout << std::setw(16) << baseline_ns << " ns (dense)"
+                              << std::setprecision(2) << std::setw(8) << baseline_ns / duration_ns << "x";
+                }
+                std::cout << std::endl;
+                break;
+        }
+    }
+}
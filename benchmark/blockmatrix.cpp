@@ -0,0 +1,555 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Sweep over block matrix, Kronecker product, A^T*A, concatenation,
+    and selection code paths; each result is reported together with the
+    duration of the equivalent dense Eigen operation.
+*/
+
+#include <sstream>
+#include <vector>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    /// Shorter measurements, the sweep contains many cases.
+    const boost::timer::nanosecond_type min_duration_ns = 20000000;
+
+
+    // Dense baselines
+    // ===========================================================================
+
+    class DenseProduct
+    {
+        public:
+            const Eigen::MatrixXd &left_;
+            const Eigen::MatrixXd &right_;
+            Eigen::MatrixXd result_;
+
+        public:
+            DenseProduct(const Eigen::MatrixXd &left, const Eigen::MatrixXd &right)
+                : left_(left), right_(right)
+            {
+            }
+
+            void operator()()
+            {
+                result_.noalias() = left_ * right_;
+            }
+    };
+
+
+    class DenseATA
+    {
+        public:
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            explicit DenseATA(const Eigen::MatrixXd &matrix) : matrix_(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                result_.noalias() = matrix_.transpose() * matrix_;
+            }
+    };
+
+
+    class DenseConcatenation
+    {
+        public:
+            const std::vector<Eigen::MatrixXd> &matrices_;
+            const bool horizontal_;
+            Eigen::MatrixXd result_;
+
+        public:
+            DenseConcatenation(const std::vector<Eigen::MatrixXd> &matrices, const bool horizontal)
+                : matrices_(matrices), horizontal_(horizontal)
+            {
+            }
+
+            void operator()()
+            {
+                const std::ptrdiff_t rows = matrices_[0].rows();
+                const std::ptrdiff_t cols = matrices_[0].cols();
+                const std::ptrdiff_t num = matrices_.size();
+
+                if (horizontal_)
+                {
+                    result_.resize(rows, num * cols);
+                    for (std::ptrdiff_t i = 0; i < num; ++i)
+                    {
+                        result_.middleCols(i * cols, cols) = matrices_[i];
+                    }
+                }
+                else
+                {
+                    result_.resize(num * rows, cols);
+                    for (std::ptrdiff_t i = 0; i < num; ++i)
+                    {
+                        result_.middleRows(i * rows, rows) = matrices_[i];
+                    }
+                }
+            }
+    };
+
+
+    // eigenut
+    // ===========================================================================
+
+    template<class t_Matrix>
+        class MultiplyRight
+    {
+        public:
+            const t_Matrix &matrix_;
+            const Eigen::MatrixXd &rhs_;
+            Eigen::MatrixXd result_;
+
+        public:
+            MultiplyRight(const t_Matrix &matrix, const Eigen::MatrixXd &rhs)
+                : matrix_(matrix), rhs_(rhs)
+            {
+            }
+
+            void operator()()
+            {
+                matrix_.multiplyRight(result_, rhs_);
+            }
+    };
+
+
+    template<class t_Matrix>
+        class MultiplyLeft
+    {
+        public:
+            const t_Matrix &matrix_;
+            const Eigen::MatrixXd &lhs_;
+            Eigen::MatrixXd result_;
+
+        public:
+            MultiplyLeft(const t_Matrix &matrix, const Eigen::MatrixXd &lhs)
+                : matrix_(matrix), lhs_(lhs)
+            {
+            }
+
+            void operator()()
+            {
+                matrix_.multiplyLeft(result_, lhs_);
+            }
+    };
+
+
+    template<class t_Kronecker>
+        class KroneckerMultiplyRight
+    {
+        public:
+            const t_Kronecker &kronecker_;
+            const Eigen::VectorXd &vector_;
+            Eigen::VectorXd result_;
+
+        public:
+            KroneckerMultiplyRight(const t_Kronecker &kronecker, const Eigen::VectorXd &vector)
+                : kronecker_(kronecker), vector_(vector)
+            {
+            }
+
+            void operator()()
+            {
+                kronecker_.multiplyRight(result_, vector_);
+            }
+    };
+
+
+    template<class t_Kronecker>
+        class KroneckerATA
+    {
+        public:
+            const t_Kronecker &kronecker_;
+            Eigen::MatrixXd result_;
+
+        public:
+            explicit KroneckerATA(const t_Kronecker &kronecker) : kronecker_(kronecker)
+            {
+            }
+
+            void operator()()
+            {
+                kronecker_.getATA(result_);
+            }
+    };
+
+
+    class ATA
+    {
+        public:
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            explicit ATA(const Eigen::MatrixXd &matrix) : matrix_(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                eigenut::getATA(result_, matrix_);
+            }
+    };
+
+
+    class Concatenation
+    {
+        public:
+            const std::vector<Eigen::MatrixXd> &matrices_;
+            const bool horizontal_;
+            Eigen::MatrixXd result_;
+
+        public:
+            Concatenation(const std::vector<Eigen::MatrixXd> &matrices, const bool horizontal)
+                : matrices_(matrices), horizontal_(horizontal)
+            {
+            }
+
+            void operator()()
+            {
+                if (horizontal_)
+                {
+                    eigenut::concatenateMatricesHorizontally(result_, matrices_);
+                }
+                else
+                {
+                    eigenut::concatenateMatricesVertically(result_, matrices_);
+                }
+            }
+    };
+
+
+    class SelectRows
+    {
+        public:
+            const Eigen::MatrixXd &matrix_;
+            const std::size_t step_;
+            Eigen::MatrixXd result_;
+
+        public:
+            SelectRows(const Eigen::MatrixXd &matrix, const std::size_t step)
+                : matrix_(matrix), step_(step)
+            {
+            }
+
+            void operator()()
+            {
+                result_ = eigenut::selectRows(matrix_, step_);
+            }
+    };
+
+
+    class SelectColumns
+    {
+        public:
+            const Eigen::MatrixXd &matrix_;
+            const std::size_t step_;
+            Eigen::MatrixXd result_;
+
+        public:
+            SelectColumns(const Eigen::MatrixXd &matrix, const std::size_t step)
+                : matrix_(matrix), step_(step)
+            {
+            }
+
+            void operator()()
+            {
+                result_ = eigenut::selectColumns(matrix_, step_);
+            }
+    };
+
+
+    class SelectionMatrixProduct
+    {
+        public:
+            const eigenut::SelectionMatrix &selection_;
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            SelectionMatrixProduct(const eigenut::SelectionMatrix &selection, const Eigen::MatrixXd &matrix)
+                : selection_(selection), matrix_(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                selection_.multiplyRight(result_, matrix_);
+            }
+    };
+
+
+    // ===========================================================================
+
+
+    template<class t_Functor, class t_Baseline>
+        void run(   const std::string &name,
+                    const std::string &parameters,
+                    t_Functor &functor,
+                    t_Baseline &baseline)
+    {
+        benchmark::report(  name,
+                            parameters,
+                            benchmark::measure(functor, min_duration_ns),
+                            benchmark::measure(baseline, min_duration_ns));
+    }
+
+
+    /**
+     * @brief Zero blocks above the block diagonal, and optionally below it.
+     */
+    void zeroBlocks(Eigen::MatrixXd &matrix, const std::ptrdiff_t block_size, const bool diagonal)
+    {
+        const std::ptrdiff_t num_blocks = matrix.rows() / block_size;
+        for (std::ptrdiff_t i = 0; i < num_blocks; ++i)
+        {
+            for (std::ptrdiff_t j = 0; j < num_blocks; ++j)
+            {
+                if ((j > i) || (diagonal && (j < i)))
+                {
+                    matrix.block(i*block_size, j*block_size, block_size, block_size).setZero();
+                }
+            }
+        }
+    }
+
+
+    template<int t_block_size>
+        void sweepBlockMatrices(const std::ptrdiff_t block_size)
+    {
+        const std::ptrdiff_t block_counts[] = {10, 100};
+        const std::ptrdiff_t rhs_widths[] = {1, 8, 32};
+
+        const std::ptrdiff_t dynamic_block_size =
+            (eigenut::MatrixBlockSizeType::DYNAMIC == t_block_size)
+            ? block_size
+            : static_cast<std::ptrdiff_t>(eigenut::MatrixBlockSizeType::UNDEFINED);
+
+        for (std::size_t i = 0; i < sizeof(block_counts) / sizeof(block_counts[0]); ++i)
+        {
+            const std::ptrdiff_t size = block_counts[i] * block_size;
+
+            const Eigen::MatrixXd generic = Eigen::MatrixXd::Random(size, size);
+            Eigen::MatrixXd diagonal = generic;
+            zeroBlocks(diagonal, block_size, true);
+            Eigen::MatrixXd lower = generic;
+            zeroBlocks(lower, block_size, false);
+
+            const eigenut::GenericBlockMatrix<t_block_size, t_block_size>
+                generic_bm(generic, dynamic_block_size, dynamic_block_size);
+            const eigenut::DiagonalBlockMatrix<t_block_size, t_block_size>
+                diagonal_bm(diagonal, dynamic_block_size, dynamic_block_size);
+            const eigenut::LeftLowerTriangularBlockMatrix<t_block_size, t_block_size>
+                lower_bm(lower, dynamic_block_size, dynamic_block_size);
+
+            for (std::size_t j = 0; j < sizeof(rhs_widths) / sizeof(rhs_widths[0]); ++j)
+            {
+                const Eigen::MatrixXd rhs = Eigen::MatrixXd::Random(size, rhs_widths[j]);
+                const Eigen::MatrixXd lhs = Eigen::MatrixXd::Random(rhs_widths[j], size);
+
+                std::stringstream parameters;
+                parameters << "block=" << block_size << "x" << block_size
+                           << ((eigenut::MatrixBlockSizeType::DYNAMIC == t_block_size) ? " dynamic" : " static")
+                           << " blocks=" << block_counts[i]
+                           << " rhs=" << rhs_widths[j];
+
+                {
+                    MultiplyRight< eigenut::GenericBlockMatrix<t_block_size, t_block_size> > functor(generic_bm, rhs);
+                    DenseProduct baseline(generic, rhs);
+                    run("blockmatrix/generic/multiply_right", parameters.str(), functor, baseline);
+                }
+                {
+                    MultiplyRight< eigenut::DiagonalBlockMatrix<t_block_size, t_block_size> > functor(diagonal_bm, rhs);
+                    DenseProduct baseline(diagonal, rhs);
+                    run("blockmatrix/diagonal/multiply_right", parameters.str(), functor, baseline);
+                }
+                {
+                    MultiplyLeft< eigenut::DiagonalBlockMatrix<t_block_size, t_block_size> > functor(diagonal_bm, lhs);
+                    DenseProduct baseline(lhs, diagonal);
+                    run("blockmatrix/diagonal/multiply_left", parameters.str(), functor, baseline);
+                }
+                {
+                    MultiplyRight< eigenut::LeftLowerTriangularBlockMatrix<t_block_size, t_block_size> > functor(lower_bm, rhs);
+                    DenseProduct baseline(lower, rhs);
+                    run("blockmatrix/lower_triangular/multiply_right", parameters.str(), functor, baseline);
+                }
+            }
+        }
+    }
+
+
+    template<class t_Kronecker>
+        void sweepKronecker(const std::string &name, const Eigen::MatrixXd &matrix, const std::ptrdiff_t num_blocks)
+    {
+        const std::ptrdiff_t identity_sizes[] = {2, 4, 8, 16};
+
+        for (std::size_t i = 0; i < sizeof(identity_sizes) / sizeof(identity_sizes[0]); ++i)
+        {
+            const t_Kronecker kronecker(matrix, identity_sizes[i]);
+
+            Eigen::MatrixXd dense;
+            kronecker.evaluate(dense);
+            const Eigen::MatrixXd vector_matrix = Eigen::MatrixXd::Random(dense.cols(), 1);
+            const Eigen::VectorXd vector = vector_matrix.col(0);
+
+            std::stringstream parameters;
+            parameters << "block=3x3 blocks=" << num_blocks << " identity=" << identity_sizes[i];
+
+            {
+                KroneckerMultiplyRight<t_Kronecker> functor(kronecker, vector);
+                DenseProduct baseline(dense, vector_matrix);
+                run("kronecker/" + name + "/multiply_right", parameters.str(), functor, baseline);
+            }
+            {
+                KroneckerATA<t_Kronecker> functor(kronecker);
+                DenseATA baseline(dense);
+                run("kronecker/" + name + "/ata", parameters.str(), functor, baseline);
+            }
+        }
+    }
+
+
+    void sweepKroneckerProducts()
+    {
+        const std::ptrdiff_t block_counts[] = {10, 20};
+
+        for (std::size_t i = 0; i < sizeof(block_counts) / sizeof(block_counts[0]); ++i)
+        {
+            const std::ptrdiff_t size = block_counts[i] * 3;
+
+            const Eigen::MatrixXd generic = Eigen::MatrixXd::Random(size, size);
+            Eigen::MatrixXd diagonal = generic;
+            zeroBlocks(diagonal, 3, true);
+
+            sweepKronecker< eigenut::GenericBlockKroneckerProduct<3, 3> >("generic", generic, block_counts[i]);
+            sweepKronecker< eigenut::DiagonalBlockKroneckerProduct<3, 3> >("diagonal", diagonal, block_counts[i]);
+        }
+    }
+
+
+    void sweepATA()
+    {
+        const std::ptrdiff_t sizes[][2] = { {1000, 10},
+                                            {5000, 30},
+                                            {200, 200} };
+
+        for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        {
+            const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(sizes[i][0], sizes[i][1]);
+
+            std::stringstream parameters;
+            parameters << "size=" << sizes[i][0] << "x" << sizes[i][1];
+
+            ATA functor(matrix);
+            DenseATA baseline(matrix);
+            run("ata/get_ata", parameters.str(), functor, baseline);
+        }
+    }
+
+
+    void sweepConcatenation()
+    {
+        const std::ptrdiff_t numbers[] = {4, 32};
+        const std::ptrdiff_t sizes[] = {10, 100};
+
+        for (std::size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); ++i)
+        {
+            for (std::size_t j = 0; j < sizeof(sizes) / sizeof(sizes[0]); ++j)
+            {
+                const std::vector<Eigen::MatrixXd> matrices(numbers[i], Eigen::MatrixXd::Random(sizes[j], sizes[j]));
+
+                std::stringstream parameters;
+                parameters << "matrices=" << numbers[i] << " size=" << sizes[j] << "x" << sizes[j];
+
+                {
+                    Concatenation functor(matrices, true);
+                    DenseConcatenation baseline(matrices, true);
+                    run("concatenation/horizontal", parameters.str(), functor, baseline);
+                }
+                {
+                    Concatenation functor(matrices, false);
+                    DenseConcatenation baseline(matrices, false);
+                    run("concatenation/vertical", parameters.str(), functor, baseline);
+                }
+            }
+        }
+    }
+
+
+    void sweepSelection()
+    {
+        const std::ptrdiff_t sizes[] = {300, 3000};
+        const std::ptrdiff_t widths[] = {3, 30};
+        const std::ptrdiff_t step = 3;
+
+        for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+        {
+            Eigen::MatrixXd selection_dense = Eigen::MatrixXd::Zero(sizes[i] / step, sizes[i]);
+            for (std::ptrdiff_t k = 0; k < selection_dense.rows(); ++k)
+            {
+                selection_dense(k, k * step) = 1.0;
+            }
+            const Eigen::MatrixXd selection_dense_transposed = selection_dense.transpose();
+            const eigenut::SelectionMatrix selection(step, 0);
+
+            for (std::size_t j = 0; j < sizeof(widths) / sizeof(widths[0]); ++j)
+            {
+                const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(sizes[i], widths[j]);
+                const Eigen::MatrixXd matrix_transposed = matrix.transpose();
+
+                std::stringstream parameters;
+                parameters << "size=" << sizes[i] << "x" << widths[j] << " step=" << step;
+
+                {
+                    SelectRows functor(matrix, step);
+                    DenseProduct baseline(selection_dense, matrix);
+                    run("selection/rows", parameters.str(), functor, baseline);
+                }
+                {
+                    SelectColumns functor(matrix_transposed, step);
+                    DenseProduct baseline(matrix_transposed, selection_dense_transposed);
+                    run("selection/columns", parameters.str(), functor, baseline);
+                }
+                {
+                    SelectionMatrixProduct functor(selection, matrix);
+                    DenseProduct baseline(selection_dense, matrix);
+                    run("selection/selection_matrix", parameters.str(), functor, baseline);
+                }
+            }
+        }
+    }
+}
+
+
+int main()
+{
+    sweepBlockMatrices<2>(2);
+    sweepBlockMatrices<eigenut::MatrixBlockSizeType::DYNAMIC>(2);
+    sweepBlockMatrices<3>(3);
+    sweepBlockMatrices<eigenut::MatrixBlockSizeType::DYNAMIC>(3);
+    sweepBlockMatrices<6>(6);
+    sweepBlockMatrices<eigenut::MatrixBlockSizeType::DYNAMIC>(6);
+    sweepBlockMatrices<12>(12);
+    sweepBlockMatrices<eigenut::MatrixBlockSizeType::DYNAMIC>(12);
+
+    sweepKroneckerProducts();
+    sweepATA();
+    sweepConcatenation();
+    sweepSelection();
+
+    return (0);
+}
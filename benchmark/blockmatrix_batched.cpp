@@ -0,0 +1,103 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Products of many small block matrices: a loop over separate
+    matrices vs. interleaved batch storage.
+*/
+
+#include <sstream>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    typedef eigenut::LeftLowerTriangularBlockMatrix<3, 3> BlockMatrix;
+    typedef eigenut::BatchedBlockMatrix<3, 3, eigenut::MatrixSparsityType::LEFT_LOWER_TRIANGULAR> BatchedMatrix;
+
+
+    class SeparateRight
+    {
+        public:
+            const std::vector<BlockMatrix> &block_matrices_;
+            const std::vector<Eigen::VectorXd> &vectors_;
+            std::vector<Eigen::VectorXd> results_;
+
+        public:
+            SeparateRight(  const std::vector<BlockMatrix> &block_matrices,
+                            const std::vector<Eigen::VectorXd> &vectors)
+                : block_matrices_(block_matrices), vectors_(vectors), results_(vectors.size())
+            {
+            }
+
+            void operator()()
+            {
+                for (std::size_t k = 0; k < block_matrices_.size(); ++k)
+                {
+                    block_matrices_[k].multiplyRight(results_[k], vectors_[k]);
+                }
+            }
+    };
+
+
+    class BatchedRight
+    {
+        public:
+            const BatchedMatrix &batched_matrix_;
+            const Eigen::MatrixXd &vectors_;
+            Eigen::MatrixXd result_;
+
+        public:
+            BatchedRight(const BatchedMatrix &batched_matrix, const Eigen::MatrixXd &vectors)
+                : batched_matrix_(batched_matrix), vectors_(vectors)
+            {
+            }
+
+            void operator()()
+            {
+                batched_matrix_.multiplyRight(result_, vectors_);
+            }
+    };
+}
+
+
+int main()
+{
+    const std::ptrdiff_t num_blocks = 10;
+    const std::ptrdiff_t batch_sizes[] = {16, 128, 1024};
+
+    for (std::size_t i = 0; i < sizeof(batch_sizes) / sizeof(batch_sizes[0]); ++i)
+    {
+        std::vector<BlockMatrix> block_matrices(batch_sizes[i]);
+        std::vector<Eigen::VectorXd> vectors(batch_sizes[i]);
+        BatchedMatrix batched_matrix;
+        Eigen::MatrixXd batched_vectors(batch_sizes[i], 3*num_blocks);
+
+        batched_matrix.setZero(batch_sizes[i], num_blocks);
+        for (std::ptrdiff_t k = 0; k < batch_sizes[i]; ++k)
+        {
+            block_matrices[k].set(Eigen::MatrixXd::Random(3*num_blocks, 3*num_blocks));
+            batched_matrix.set(k, block_matrices[k].getRaw());
+
+            vectors[k] = Eigen::VectorXd::Random(3*num_blocks);
+            batched_vectors.row(k) = vectors[k].transpose();
+        }
+
+        std::stringstream parameters;
+        parameters << "batch=" << batch_sizes[i] << " blocks=" << num_blocks << " block=3x3";
+
+
+        SeparateRight separate_right(block_matrices, vectors);
+        benchmark::report("blockmatrix/separate_llt_right", parameters.str(), benchmark::measure(separate_right));
+
+        BatchedRight batched_right(batched_matrix, batched_vectors);
+        benchmark::report("blockmatrix/batched_llt_right", parameters.str(), benchmark::measure(batched_right));
+    }
+
+    return (0);
+}
@@ -0,0 +1,107 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Products of block matrices with small blocks: column-major
+    storage of the whole matrix vs. tile storage.
+*/
+
+#include <sstream>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    template<class t_BlockMatrix>
+    class BlockMatrixRight
+    {
+        public:
+            const t_BlockMatrix &block_matrix_;
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            BlockMatrixRight(const t_BlockMatrix &block_matrix, const Eigen::MatrixXd &matrix)
+                : block_matrix_(block_matrix), matrix_(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                block_matrix_.multiplyRight(result_, matrix_);
+            }
+    };
+
+
+    template<class t_BlockMatrix>
+    class BlockMatrixLeft
+    {
+        public:
+            const t_BlockMatrix &block_matrix_;
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            BlockMatrixLeft(const t_BlockMatrix &block_matrix, const Eigen::MatrixXd &matrix)
+                : block_matrix_(block_matrix), matrix_(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                block_matrix_.multiplyLeft(result_, matrix_);
+            }
+    };
+}
+
+
+int main()
+{
+    const std::ptrdiff_t num_blocks[] = {10, 100, 1000};
+
+    for (std::size_t i = 0; i < sizeof(num_blocks) / sizeof(num_blocks[0]); ++i)
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(3*num_blocks[i], 3*num_blocks[i]);
+        const Eigen::MatrixXd vector = Eigen::MatrixXd::Random(3*num_blocks[i], 1);
+        const Eigen::MatrixXd vector_transposed = vector.transpose();
+
+        std::stringstream parameters;
+        parameters << "blocks=" << num_blocks[i] << " block=3x3";
+
+
+        const eigenut::DiagonalBlockMatrix<3, 3> diagonal(matrix);
+        const eigenut::TiledBlockMatrix<3, 3, eigenut::MatrixSparsityType::DIAGONAL> tiled_diagonal(matrix);
+
+        BlockMatrixRight< eigenut::DiagonalBlockMatrix<3, 3> > diagonal_right(diagonal, vector);
+        benchmark::report("blockmatrix/diagonal_right", parameters.str(), benchmark::measure(diagonal_right));
+
+        BlockMatrixRight< eigenut::TiledBlockMatrix<3, 3, eigenut::MatrixSparsityType::DIAGONAL> >
+            tiled_diagonal_right(tiled_diagonal, vector);
+        benchmark::report("blockmatrix/tiled_diagonal_right", parameters.str(), benchmark::measure(tiled_diagonal_right));
+
+        BlockMatrixLeft< eigenut::DiagonalBlockMatrix<3, 3> > diagonal_left(diagonal, vector_transposed);
+        benchmark::report("blockmatrix/diagonal_left", parameters.str(), benchmark::measure(diagonal_left));
+
+        BlockMatrixLeft< eigenut::TiledBlockMatrix<3, 3, eigenut::MatrixSparsityType::DIAGONAL> >
+            tiled_diagonal_left(tiled_diagonal, vector_transposed);
+        benchmark::report("blockmatrix/tiled_diagonal_left", parameters.str(), benchmark::measure(tiled_diagonal_left));
+
+
+        const eigenut::LeftLowerTriangularBlockMatrix<3, 3> llt(matrix);
+        const eigenut::TiledBlockMatrix<3, 3, eigenut::MatrixSparsityType::LEFT_LOWER_TRIANGULAR> tiled_llt(matrix);
+
+        BlockMatrixRight< eigenut::LeftLowerTriangularBlockMatrix<3, 3> > llt_right(llt, vector);
+        benchmark::report("blockmatrix/llt_right", parameters.str(), benchmark::measure(llt_right));
+
+        BlockMatrixRight< eigenut::TiledBlockMatrix<3, 3, eigenut::MatrixSparsityType::LEFT_LOWER_TRIANGULAR> >
+            tiled_llt_right(tiled_llt, vector);
+        benchmark::report("blockmatrix/tiled_llt_right", parameters.str(), benchmark::measure(tiled_llt_right));
+    }
+
+    return (0);
+}
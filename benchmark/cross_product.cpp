@@ -0,0 +1,121 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Products with cross product matrices: explicit 3x3 matrix vs.
+    specialized kernels.
+*/
+
+#include <sstream>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    class CrossProduct
+    {
+        public:
+            const eigenut::Vector3 vector_;
+            const eigenut::CrossProductMatrix cross_product_;
+            const Eigen::MatrixXd &matrix_;
+            Eigen::MatrixXd result_;
+
+        public:
+            explicit CrossProduct(const Eigen::MatrixXd &matrix) :
+                vector_(eigenut::Vector3::Random()),
+                cross_product_(vector_),
+                matrix_(matrix)
+            {
+            }
+    };
+
+
+    class CrossProductLeftEval : public CrossProduct
+    {
+        public:
+            explicit CrossProductLeftEval(const Eigen::MatrixXd &matrix) : CrossProduct(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                result_.noalias() = matrix_ * cross_product_.eval();
+            }
+    };
+
+
+    class CrossProductLeft : public CrossProduct
+    {
+        public:
+            explicit CrossProductLeft(const Eigen::MatrixXd &matrix) : CrossProduct(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                cross_product_.multiplyLeft(result_, matrix_);
+            }
+    };
+
+
+    class CrossProductRightEval : public CrossProduct
+    {
+        public:
+            explicit CrossProductRightEval(const Eigen::MatrixXd &matrix) : CrossProduct(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                result_.noalias() = cross_product_.eval() * matrix_;
+            }
+    };
+
+
+    class CrossProductRight : public CrossProduct
+    {
+        public:
+            explicit CrossProductRight(const Eigen::MatrixXd &matrix) : CrossProduct(matrix)
+            {
+            }
+
+            void operator()()
+            {
+                cross_product_.multiplyRight(result_, matrix_);
+            }
+    };
+}
+
+
+int main()
+{
+    const std::ptrdiff_t sizes[] = {6, 100, 10000};
+
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        Eigen::MatrixXd matrix_nx3 = Eigen::MatrixXd::Random(sizes[i], 3);
+        Eigen::MatrixXd matrix_3xn = Eigen::MatrixXd::Random(3, sizes[i]);
+
+        std::stringstream parameters;
+        parameters << "N=" << sizes[i];
+
+        CrossProductLeftEval left_eval(matrix_nx3);
+        benchmark::report("cross_product/left_eval", parameters.str(), benchmark::measure(left_eval));
+
+        CrossProductLeft left(matrix_nx3);
+        benchmark::report("cross_product/left", parameters.str(), benchmark::measure(left));
+
+        CrossProductRightEval right_eval(matrix_3xn);
+        benchmark::report("cross_product/right_eval", parameters.str(), benchmark::measure(right_eval));
+
+        CrossProductRight right(matrix_3xn);
+        benchmark::report("cross_product/right", parameters.str(), benchmark::measure(right));
+    }
+
+    return (0);
+}
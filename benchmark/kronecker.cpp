@@ -0,0 +1,92 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Block Kronecker product times vector: single matrix-matrix
+    multiplication vs. matrix-vector multiplication for each copy of the matrix.
+*/
+
+#include <sstream>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    class KroneckerVectorProduct
+    {
+        public:
+            const eigenut::GenericBlockKroneckerProduct<3, 3> &kronecker_;
+            const Eigen::VectorXd &vector_;
+            Eigen::VectorXd result_;
+
+        public:
+            KroneckerVectorProduct( const eigenut::GenericBlockKroneckerProduct<3, 3> &kronecker,
+                                    const Eigen::VectorXd &vector)
+                : kronecker_(kronecker), vector_(vector)
+            {
+            }
+    };
+
+
+    class KroneckerVectorProductReshaped : public KroneckerVectorProduct
+    {
+        public:
+            KroneckerVectorProductReshaped( const eigenut::GenericBlockKroneckerProduct<3, 3> &kronecker,
+                                            const Eigen::VectorXd &vector)
+                : KroneckerVectorProduct(kronecker, vector)
+            {
+            }
+
+            void operator()()
+            {
+                kronecker_.multiplyRightReshaped(result_, vector_);
+            }
+    };
+
+
+    class KroneckerVectorProductSegmentwise : public KroneckerVectorProduct
+    {
+        public:
+            KroneckerVectorProductSegmentwise(  const eigenut::GenericBlockKroneckerProduct<3, 3> &kronecker,
+                                                const Eigen::VectorXd &vector)
+                : KroneckerVectorProduct(kronecker, vector)
+            {
+            }
+
+            void operator()()
+            {
+                kronecker_.multiplyRightSegmentwise(result_, vector_);
+            }
+    };
+}
+
+
+int main()
+{
+    const std::ptrdiff_t num_blocks = 20;
+    const std::ptrdiff_t identity_sizes[] = {2, 4, 8, 16, 32, 64};
+
+    Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(3*num_blocks, 3*num_blocks);
+
+    for (std::size_t i = 0; i < sizeof(identity_sizes) / sizeof(identity_sizes[0]); ++i)
+    {
+        eigenut::GenericBlockKroneckerProduct<3, 3> kronecker(matrix, identity_sizes[i]);
+        Eigen::VectorXd vector = Eigen::VectorXd::Random(matrix.cols() * identity_sizes[i]);
+
+        std::stringstream parameters;
+        parameters << "blocks=" << num_blocks << "x" << num_blocks << " block=3x3 identity=" << identity_sizes[i];
+
+        KroneckerVectorProductReshaped reshaped(kronecker, vector);
+        benchmark::report("kronecker_vector/reshaped", parameters.str(), benchmark::measure(reshaped));
+
+        KroneckerVectorProductSegmentwise segmentwise(kronecker, vector);
+        benchmark::report("kronecker_vector/segmentwise", parameters.str(), benchmark::measure(segmentwise));
+    }
+
+    return (0);
+}
@@ -0,0 +1,105 @@
+/**
+    @file
+    @author  Alexander Sherikov
+
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Transformation of 3d points: allocating expression vs. chunked
+    kernels with array-of-structures and structure-of-arrays layouts.
+*/
+
+#include <sstream>
+
+#include <eigenut/all.h>
+#include "benchmark_common.h"
+
+
+namespace
+{
+    class Transform
+    {
+        public:
+            const Eigen::MatrixXd &points_;
+            const Eigen::Matrix3d rotation_;
+            const Eigen::Vector3d translation_;
+            Eigen::MatrixXd result_;
+
+        public:
+            explicit Transform(const Eigen::MatrixXd &points) :
+                points_(points),
+                rotation_(Eigen::Quaterniond::UnitRandom().toRotationMatrix()),
+                translation_(Eigen::Vector3d::Random())
+            {
+                result_.resize(points_.rows(), points_.cols());
+            }
+    };
+
+
+    class TransformExpression : public Transform
+    {
+        public:
+            explicit TransformExpression(const Eigen::MatrixXd &points) : Transform(points)
+            {
+            }
+
+            void operator()()
+            {
+                result_ = eigenut::transform(points_, rotation_, translation_);
+            }
+    };
+
+
+    class TransformChunked : public Transform
+    {
+        public:
+            explicit TransformChunked(const Eigen::MatrixXd &points) : Transform(points)
+            {
+            }
+
+            void operator()()
+            {
+                eigenut::transform(result_, points_, rotation_, translation_);
+            }
+    };
+
+
+    class TransformSoA : public Transform
+    {
+        public:
+            explicit TransformSoA(const Eigen::MatrixXd &points) : Transform(points)
+            {
+            }
+
+            void operator()()
+            {
+                eigenut::transformSoA(result_, points_, rotation_, translation_);
+            }
+    };
+}
+
+
+int main()
+{
+    const std::ptrdiff_t sizes[] = {100, 10000, 1000000};
+
+    for (std::size_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); ++i)
+    {
+        Eigen::MatrixXd points = Eigen::MatrixXd::Random(3, sizes[i]);
+        Eigen::MatrixXd points_soa = points.transpose();
+
+        std::stringstream parameters;
+        parameters << "points=" << sizes[i];
+
+        TransformExpression expression(points);
+        benchmark::report("transform/expression", parameters.str(), benchmark::measure(expression));
+
+        TransformChunked chunked(points);
+        benchmark::report("transform/chunked", parameters.str(), benchmark::measure(chunked));
+
+        TransformSoA soa(points_soa);
+        benchmark::report("transform/soa", parameters.str(), benchmark::measure(soa));
+    }
+
+    return (0);
+}
@@ -23,9 +23,14 @@ namespace eigenut
 
 #include "types.h"
 #include "misc.h"
+#include "growable_matrix.h"
+#include "block_diagonal.h"
 #include "cross_product.h"
 #include "blockmatrix_base.h"
 #include "blockmatrix_kronecker.h"
 #include "blockmatrix.h"
+#include "blockmatrix_tiled.h"
+#include "blockmatrix_batched.h"
+#include "blockmatrix_instantiations.h"
 
 #endif
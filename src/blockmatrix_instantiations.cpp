@@ -0,0 +1,27 @@
+/**
+    @file
+    @author  Alexander Sherikov
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief Explicit instantiation definitions of block matrix kernels, see
+    blockmatrix_instantiations.h.
+*/
+
+#include <eigenut/all.h>
+
+
+namespace eigenut
+{
+#define EIGENUT_INSTANTIATION_PREFIX template
+
+#define EIGENUT_INSTANTIATION_SCALAR double
+    EIGENUT_INSTANTIATE_BLOCKMATRIX_KERNELS
+#undef EIGENUT_INSTANTIATION_SCALAR
+
+#define EIGENUT_INSTANTIATION_SCALAR float
+    EIGENUT_INSTANTIATE_BLOCKMATRIX_KERNELS
+#undef EIGENUT_INSTANTIATION_SCALAR
+
+#undef EIGENUT_INSTANTIATION_PREFIX
+}
@@ -135,4 +135,650 @@ namespace
         BOOST_REQUIRE_NO_THROW(manipulateDynamicMatrix01_00());
         BOOST_REQUIRE_NO_THROW(manipulateDynamicMatrix01_01());
     }
+
+
+    BOOST_AUTO_TEST_CASE(KroneckerVectorProduct)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 9);
+        Eigen::MatrixXd expected_result;
+        Eigen::VectorXd result;
+        Eigen::VectorXd result_segmentwise;
+        Eigen::VectorXd result_reshaped;
+        const std::ptrdiff_t identity_size = 4;
+        const Eigen::VectorXd vector = Eigen::VectorXd::Random(matrix.cols() * identity_size);
+
+
+        eigenut::GenericBlockKroneckerProduct<2, 3> generic_kronecker(matrix, identity_size);
+        expected_result = generic_kronecker.evaluate() * vector;
+        generic_kronecker.multiplyRight(result, vector);
+        generic_kronecker.multiplyRightSegmentwise(result_segmentwise, vector);
+        generic_kronecker.multiplyRightReshaped(result_reshaped, vector);
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+        BOOST_CHECK(result_segmentwise.isApprox(expected_result, 1e-12));
+        BOOST_CHECK(result_reshaped.isApprox(expected_result, 1e-12));
+
+
+        // the vector and / or the result are mapped without copying
+        eigenut::GenericBlockKroneckerProduct<6, 9> single_block_kronecker(matrix, identity_size);
+        single_block_kronecker.multiplyRightReshaped(result_reshaped, vector);
+        BOOST_CHECK(result_reshaped.isApprox(single_block_kronecker.evaluate() * vector, 1e-12));
+
+        eigenut::GenericBlockKroneckerProduct<2, 9> block_column_kronecker(matrix, identity_size);
+        block_column_kronecker.multiplyRightReshaped(result_reshaped, vector);
+        BOOST_CHECK(result_reshaped.isApprox(block_column_kronecker.evaluate() * vector, 1e-12));
+
+        eigenut::GenericBlockKroneckerProduct<6, 3> block_row_kronecker(matrix, identity_size);
+        block_row_kronecker.multiplyRightReshaped(result_reshaped, vector);
+        BOOST_CHECK(result_reshaped.isApprox(block_row_kronecker.evaluate() * vector, 1e-12));
+
+
+        eigenut::GenericBlockKroneckerProduct<  eigenut::MatrixBlockSizeType::DYNAMIC,
+                                                eigenut::MatrixBlockSizeType::DYNAMIC> dynamic_kronecker(matrix, identity_size, 3, 3);
+        expected_result = dynamic_kronecker.evaluate() * vector;
+        dynamic_kronecker.multiplyRight(result, vector);
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+
+
+        matrix = Eigen::MatrixXd::Random(6, 6).triangularView<Eigen::Lower>();
+        eigenut::LeftLowerTriangularBlockKroneckerProduct<2, 2> llt_kronecker(matrix, identity_size);
+        expected_result = llt_kronecker.evaluate() * vector.head(matrix.cols() * identity_size);
+        llt_kronecker.multiplyRight(result, vector.head(matrix.cols() * identity_size).eval());
+        llt_kronecker.multiplyRightReshaped(result_reshaped, vector.head(matrix.cols() * identity_size).eval());
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+        BOOST_CHECK(result_reshaped.isApprox(expected_result, 1e-12));
+
+
+        eigenut::GenericBlockKroneckerProduct<1, 1> scalar_kronecker(matrix, identity_size);
+        expected_result = scalar_kronecker.evaluate() * vector.head(matrix.cols() * identity_size);
+        scalar_kronecker.multiplyRight(result, vector.head(matrix.cols() * identity_size).eval());
+        scalar_kronecker.multiplyRightSegmentwise(result_segmentwise, vector.head(matrix.cols() * identity_size).eval());
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+        BOOST_CHECK(result_segmentwise.isApprox(expected_result, 1e-12));
+    }
+
+
+    template<int t_block_size>
+        Eigen::MatrixXd expandKroneckerGramMatrix(  Eigen::MatrixXd factor,
+                                                    const std::ptrdiff_t identity_size)
+    {
+        eigenut::convertLLTtoSymmetric(factor);
+        eigenut::GenericBlockKroneckerProduct<t_block_size, t_block_size> gram(factor, identity_size);
+        Eigen::MatrixXd result = gram.evaluate();
+        return (result.triangularView<Eigen::Lower>());
+    }
+
+
+    BOOST_AUTO_TEST_CASE(KroneckerGramMatrix)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 9);
+        Eigen::MatrixXd expected_result;
+        Eigen::MatrixXd result;
+        std::ptrdiff_t identity_size = 4;
+
+
+        eigenut::GenericBlockKroneckerProduct<2, 3> generic_kronecker(matrix, identity_size);
+        eigenut::getATA(expected_result, generic_kronecker.evaluate());
+        expected_result = expected_result.triangularView<Eigen::Lower>();
+
+        eigenut::getATA(result, generic_kronecker);
+        BOOST_CHECK_EQUAL(result.rows(), matrix.cols());
+        BOOST_CHECK(expandKroneckerGramMatrix<3>(result, identity_size).isApprox(expected_result, 1e-12));
+
+        eigenut::addATA(result, generic_kronecker);
+        BOOST_CHECK(expandKroneckerGramMatrix<3>(result, identity_size).isApprox(2 * expected_result, 1e-12));
+
+
+        matrix = Eigen::MatrixXd::Random(6, 6);
+        eigenut::LeftLowerTriangularBlockKroneckerProduct<2, 2> llt_kronecker(matrix, identity_size);
+        eigenut::getATA(expected_result, llt_kronecker.evaluate());
+        expected_result = expected_result.triangularView<Eigen::Lower>();
+
+        eigenut::getATA(result, llt_kronecker);
+        BOOST_CHECK(expandKroneckerGramMatrix<2>(result, identity_size).isApprox(expected_result, 1e-12));
+
+
+        eigenut::LeftLowerTriangularBlockKroneckerProduct<1, 1> scalar_llt_kronecker(matrix, identity_size);
+        eigenut::getATA(expected_result, scalar_llt_kronecker.evaluate());
+        expected_result = expected_result.triangularView<Eigen::Lower>();
+
+        eigenut::getATA(result, scalar_llt_kronecker);
+        BOOST_CHECK(expandKroneckerGramMatrix<1>(result, identity_size).isApprox(expected_result, 1e-12));
+        BOOST_CHECK_EQUAL(scalar_llt_kronecker.getIdentitySize(), identity_size);
+    }
+
+
+    BOOST_AUTO_TEST_CASE(SelectInBlocks)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 9);
+        Eigen::MatrixXd expected_result = matrix;
+
+        eigenut::GenericBlockMatrix<3, 3> block_matrix(matrix);
+
+        BOOST_CHECK(block_matrix.selectRowInBlocksAsMap(1) == block_matrix.selectRowInBlocksAsMatrix(1));
+        BOOST_CHECK(block_matrix.selectRowInBlocksAsMap(2) == eigenut::selectRows(matrix, 3, 2));
+        BOOST_CHECK(block_matrix.selectColumnInBlocksAsMap(1) == eigenut::selectColumns(matrix, 3, 1));
+
+        // in-place update
+        block_matrix.selectRowInBlocksAsMap(2).array() += 1.0;
+        eigenut::selectRows(expected_result, 3, 2).array() += 1.0;
+        BOOST_CHECK(block_matrix.getRaw() == expected_result);
+
+        block_matrix.selectColumnInBlocksAsMap(0).setZero();
+        for (std::ptrdiff_t i = 0; i < 3; ++i)
+        {
+            expected_result.col(3*i).setZero();
+        }
+        BOOST_CHECK(block_matrix.getRaw() == expected_result);
+
+        const eigenut::GenericBlockMatrix<3, 3> & const_block_matrix = block_matrix;
+        BOOST_CHECK(const_block_matrix.selectColumnInBlocksAsMap(0).isZero());
+        BOOST_CHECK_EQUAL(const_block_matrix.selectRowInBlocksAsMap(0).rows(), 2);
+        BOOST_CHECK_EQUAL(const_block_matrix.selectColumnInBlocksAsMap(0).cols(), 3);
+    }
+
+
+    BOOST_AUTO_TEST_CASE(SparseConversion)
+    {
+        Eigen::SparseMatrix<double> sparse;
+        std::vector< Eigen::Triplet<double> > triplets;
+        Eigen::MatrixXd expected_result;
+
+
+        eigenut::GenericBlockMatrix<2, 3> generic_matrix(Eigen::MatrixXd::Random(4, 9));
+        generic_matrix.toSparse(sparse);
+        BOOST_CHECK_EQUAL(sparse.nonZeros(), 36);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(generic_matrix.getRaw()));
+
+
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 6);
+        eigenut::DiagonalBlockMatrix<2, 2> diagonal_matrix(matrix);
+        expected_result.setZero(6, 6);
+        for (std::ptrdiff_t i = 0; i < 3; ++i)
+        {
+            expected_result.block(i*2, i*2, 2, 2) = diagonal_matrix(i);
+        }
+        diagonal_matrix.toSparse(sparse);
+        BOOST_CHECK_EQUAL(sparse.nonZeros(), 12);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(expected_result));
+
+        diagonal_matrix.set(2 * matrix);
+        diagonal_matrix.updateSparseValues(sparse);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(2 * expected_result));
+
+
+        eigenut::LeftLowerTriangularBlockMatrix<2, 2> llt_matrix(matrix);
+        expected_result = matrix;
+        expected_result.block(0, 2, 2, 4).setZero();
+        expected_result.block(2, 4, 2, 2).setZero();
+        llt_matrix.toTriplets(triplets, 1, 2);
+        BOOST_CHECK_EQUAL(triplets.size(), 24u);
+        sparse.resize(7, 8);
+        sparse.setFromTriplets(triplets.begin(), triplets.end());
+        BOOST_CHECK(Eigen::MatrixXd(sparse).block(1, 2, 6, 6).isApprox(expected_result));
+
+
+        const std::ptrdiff_t identity_size = 3;
+
+        eigenut::GenericBlockKroneckerProduct<2, 3> generic_kronecker(Eigen::MatrixXd::Random(4, 6), identity_size);
+        generic_kronecker.toSparse(sparse);
+        BOOST_CHECK_EQUAL(sparse.nonZeros(), 72);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(generic_kronecker.evaluate()));
+
+        eigenut::GenericBlockKroneckerProduct<1, 1> scalar_kronecker(matrix, identity_size);
+        scalar_kronecker.toSparse(sparse);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(scalar_kronecker.evaluate()));
+
+        eigenut::LeftLowerTriangularBlockKroneckerProduct<2, 2> llt_kronecker(expected_result, identity_size);
+        llt_kronecker.toSparse(sparse);
+        BOOST_CHECK_EQUAL(sparse.nonZeros(), 72);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(llt_kronecker.evaluate()));
+
+        triplets.clear();
+        llt_kronecker.toTriplets(triplets);
+        sparse.setFromTriplets(triplets.begin(), triplets.end());
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(llt_kronecker.evaluate()));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(SinglePrecision)
+    {
+        const Eigen::MatrixXf matrix = Eigen::MatrixXf::Random(6, 6);
+        const Eigen::MatrixXf vector = Eigen::MatrixXf::Random(6, 1);
+        const std::ptrdiff_t identity_size = 3;
+
+
+        eigenut::GenericBlockMatrix<2, 3, float> generic_matrix(matrix);
+        BOOST_CHECK((generic_matrix * vector).isApprox(matrix * vector));
+
+
+        eigenut::DiagonalBlockMatrix<2, 2, float> diagonal_matrix(matrix);
+        Eigen::MatrixXf expected_result = Eigen::MatrixXf::Zero(6, 6);
+        for (std::ptrdiff_t i = 0; i < 3; ++i)
+        {
+            expected_result.block(i*2, i*2, 2, 2) = diagonal_matrix(i);
+        }
+        BOOST_CHECK((diagonal_matrix * vector).isApprox(expected_result * vector));
+
+        Eigen::SparseMatrix<float> sparse;
+        diagonal_matrix.toSparse(sparse);
+        BOOST_CHECK(Eigen::MatrixXf(sparse).isApprox(expected_result));
+
+
+        eigenut::ConstBlockMatrixInterface<3, 3, eigenut::MatrixSparsityType::NONE, float> interface(matrix);
+        BOOST_CHECK((interface * vector).isApprox(matrix * vector));
+
+
+        eigenut::GenericBlockKroneckerProduct<2, 3, float> kronecker(matrix, identity_size);
+        Eigen::VectorXf result;
+        const Eigen::VectorXf kronecker_vector = Eigen::VectorXf::Random(matrix.cols() * identity_size);
+        kronecker.multiplyRight(result, kronecker_vector);
+        BOOST_CHECK(result.isApprox(kronecker.evaluate() * kronecker_vector));
+
+
+        std::vector<Eigen::MatrixXf> blocks;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            blocks.push_back(Eigen::MatrixXf::Random(2, 3));
+        }
+        Eigen::MatrixXf dense;
+        const Eigen::MatrixXf right = Eigen::MatrixXf::Random(9, 2);
+        const Eigen::MatrixXf left = Eigen::MatrixXf::Random(2, 6);
+
+        eigenut::CompactBlockDiagonalMatrix<float> compact;
+        eigenut::makeBlockDiagonal(compact, blocks);
+        compact.evaluate(dense);
+        BOOST_CHECK((compact * right).isApprox(dense * right));
+        BOOST_CHECK((left * compact).isApprox(left * dense));
+
+        eigenut::makeBlockDiagonal(compact, blocks[0], 3);
+        compact.evaluate(dense);
+        BOOST_CHECK(compact.isRepeated());
+        BOOST_CHECK((compact * right).isApprox(dense * right));
+
+        eigenut::VariableBlockDiagonalMatrix<float> variable;
+        eigenut::makeBlockDiagonal(variable, blocks);
+        variable.evaluate(dense);
+        BOOST_CHECK((variable * right).isApprox(dense * right));
+        BOOST_CHECK((left * variable).isApprox(left * dense));
+
+
+        eigenut::StackedCrossProductMatrix<float> cross_product(Eigen::MatrixXf::Random(3, 2));
+        cross_product.evaluate(dense);
+        BOOST_CHECK((cross_product * matrix).isApprox(dense * matrix));
+        BOOST_CHECK((matrix * cross_product).isApprox(matrix * dense));
+
+        const eigenut::DiagonalBlockMatrix<3, 3, float> cross_blocks(matrix);
+        Eigen::MatrixXf cross_blocks_dense = Eigen::MatrixXf::Zero(6, 6);
+        cross_blocks_dense.topLeftCorner(3, 3) = matrix.topLeftCorner(3, 3);
+        cross_blocks_dense.bottomRightCorner(3, 3) = matrix.bottomRightCorner(3, 3);
+        BOOST_CHECK((cross_product * cross_blocks).isApprox(dense * cross_blocks_dense));
+        BOOST_CHECK((cross_blocks * cross_product).isApprox(cross_blocks_dense * dense));
+
+
+        // extended precision must not be rounded to DefaultScalar
+        typedef Eigen::Matrix<long double, Eigen::Dynamic, Eigen::Dynamic> MatrixXld;
+
+        const MatrixXld vectors_long = MatrixXld::Random(3, 2) / 3;
+        const eigenut::StackedCrossProductMatrix<long double> cross_product_long(vectors_long);
+        MatrixXld dense_long;
+        cross_product_long.evaluate(dense_long);
+        BOOST_CHECK(dense_long(2, 1) == vectors_long(0, 0));
+        BOOST_CHECK(dense_long(3, 5) == vectors_long(1, 1));
+
+        const MatrixXld cross_blocks_long_raw = MatrixXld::Random(6, 6) / 3;
+        const eigenut::DiagonalBlockMatrix<3, 3, long double> cross_blocks_long(cross_blocks_long_raw);
+        MatrixXld cross_blocks_long_dense = MatrixXld::Zero(6, 6);
+        cross_blocks_long_dense.topLeftCorner(3, 3) = cross_blocks_long_raw.topLeftCorner(3, 3);
+        cross_blocks_long_dense.bottomRightCorner(3, 3) = cross_blocks_long_raw.bottomRightCorner(3, 3);
+
+        MatrixXld exact_long;
+        cross_product_long.multiplyRight(exact_long, cross_blocks_long_dense);
+        BOOST_CHECK((dense_long * cross_blocks_long_dense).isApprox(exact_long, 1e-18L));
+        BOOST_CHECK((cross_product_long * cross_blocks_long).isApprox(exact_long, 1e-18L));
+        cross_product_long.multiplyLeft(exact_long, cross_blocks_long_dense);
+        BOOST_CHECK((cross_blocks_long * cross_product_long).isApprox(exact_long, 1e-18L));
+
+
+        Eigen::MatrixXf positive_definite;
+        eigenut::getRandomPositiveDefiniteMatrix(positive_definite, 4);
+        BOOST_CHECK(Eigen::Success == positive_definite.llt().info());
+
+
+        Eigen::MatrixXf unset(2, 2);
+        eigenut::unsetMatrix(unset);
+        BOOST_CHECK(unset.hasNaN());
+    }
+
+
+    BOOST_AUTO_TEST_CASE(MixedPrecision)
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 6);
+        const Eigen::MatrixXf matrix_float = matrix.cast<float>();
+        const Eigen::MatrixXd matrix_rounded = matrix_float.cast<double>();
+        const Eigen::MatrixXd vectors = Eigen::MatrixXd::Random(6, 2);
+        const std::ptrdiff_t identity_size = 3;
+        Eigen::MatrixXd result;
+        Eigen::MatrixXd expected_result;
+
+
+        eigenut::GenericBlockMatrix<2, 3, float> generic_matrix(matrix_float);
+        generic_matrix.multiplyRight(result, vectors);
+        BOOST_CHECK(result.isApprox(matrix_rounded * vectors, 1e-12));
+
+
+        eigenut::DiagonalBlockMatrix<2, 2, float> diagonal_matrix(matrix_float);
+        eigenut::DiagonalBlockMatrix<2, 2> diagonal_matrix_double(matrix_rounded);
+
+        diagonal_matrix.multiplyRight(result, vectors);
+        diagonal_matrix_double.multiplyRight(expected_result, vectors);
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+
+        diagonal_matrix.multiplyLeft(result, vectors.transpose());
+        diagonal_matrix_double.multiplyLeft(expected_result, vectors.transpose());
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+
+
+        eigenut::LeftLowerTriangularBlockMatrix<1, 1, float> llt_matrix(matrix_float);
+        llt_matrix.multiplyRight(result, vectors);
+        expected_result = matrix_rounded.triangularView<Eigen::Lower>() * vectors;
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+
+
+        Eigen::VectorXd vector_result;
+        const Eigen::VectorXd vector = Eigen::VectorXd::Random(matrix.cols() * identity_size);
+
+        eigenut::GenericBlockKroneckerProduct<2, 3, float> kronecker(matrix_float, identity_size);
+        eigenut::GenericBlockKroneckerProduct<2, 3> kronecker_double(matrix_rounded, identity_size);
+        expected_result = kronecker_double.evaluate() * vector;
+
+        kronecker.multiplyRightSegmentwise(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(expected_result, 1e-12));
+        kronecker.multiplyRightReshaped(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(expected_result, 1e-12));
+
+        eigenut::GenericBlockKroneckerProduct<6, 6, float> single_block_kronecker(matrix_float, identity_size);
+        eigenut::GenericBlockKroneckerProduct<6, 6> single_block_kronecker_double(matrix_rounded, identity_size);
+        single_block_kronecker.multiplyRightReshaped(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(single_block_kronecker_double.evaluate() * vector, 1e-12));
+
+        eigenut::GenericBlockKroneckerProduct<1, 1, float> scalar_kronecker(matrix_float, identity_size);
+        eigenut::GenericBlockKroneckerProduct<1, 1> scalar_kronecker_double(matrix_rounded, identity_size);
+        scalar_kronecker.multiplyRight(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(scalar_kronecker_double.evaluate() * vector, 1e-12));
+
+
+        // large operands are converted panel by panel and multiplied with GEMM
+        const Eigen::MatrixXf large_matrix_float = Eigen::MatrixXf::Random(40, 600);
+        const Eigen::MatrixXd large_vectors = Eigen::MatrixXd::Random(600, 20);
+
+        eigenut::GenericBlockMatrix<2, 3, float> large_matrix(large_matrix_float);
+        large_matrix.multiplyRight(result, large_vectors);
+        BOOST_CHECK(result.isApprox(large_matrix_float.cast<double>() * large_vectors, 1e-12));
+
+        // two column panels of a lower triangular matrix, the upper part is ignored
+        const Eigen::MatrixXf large_square_float = Eigen::MatrixXf::Random(300, 300);
+        const Eigen::MatrixXd large_square_vectors = Eigen::MatrixXd::Random(300, 20);
+
+        eigenut::LeftLowerTriangularBlockMatrix<1, 1, float> large_llt_matrix(large_square_float);
+        large_llt_matrix.multiplyRight(result, large_square_vectors);
+        expected_result = large_square_float.cast<double>().triangularView<Eigen::Lower>() * large_square_vectors;
+        BOOST_CHECK(result.isApprox(expected_result, 1e-12));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(TiledBlockMatrix)
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 6);
+        const Eigen::MatrixXd right = Eigen::MatrixXd::Random(6, 2);
+        const Eigen::MatrixXd left = Eigen::MatrixXd::Random(3, 6);
+        Eigen::MatrixXd expected_result;
+        Eigen::MatrixXd result;
+
+
+        eigenut::TiledBlockMatrix<2, 3, eigenut::MatrixSparsityType::NONE> generic_matrix(matrix);
+        BOOST_CHECK_EQUAL(generic_matrix.getNumberOfBlocksVertical(), 3);
+        BOOST_CHECK_EQUAL(generic_matrix.getNumberOfBlocksHorizontal(), 2);
+        BOOST_CHECK(generic_matrix(1, 1).isApprox(matrix.block(2, 3, 2, 3)));
+        generic_matrix.evaluate(result);
+        BOOST_CHECK(result.isApprox(matrix));
+        BOOST_CHECK((generic_matrix * right).isApprox(matrix * right));
+        BOOST_CHECK((left * generic_matrix).isApprox(left * matrix));
+
+
+        eigenut::DiagonalBlockMatrix<2, 2> diagonal_matrix(matrix);
+        eigenut::TiledBlockMatrix<2, 2, eigenut::MatrixSparsityType::DIAGONAL> tiled_diagonal_matrix(matrix);
+        BOOST_CHECK_EQUAL(tiled_diagonal_matrix.getRaw().size(), 12);
+        BOOST_CHECK((tiled_diagonal_matrix * right).isApprox(diagonal_matrix * right));
+        diagonal_matrix.multiplyLeft(expected_result, left);
+        BOOST_CHECK((left * tiled_diagonal_matrix).isApprox(expected_result));
+
+
+        expected_result = matrix;
+        expected_result.block(0, 2, 2, 4).setZero();
+        expected_result.block(2, 4, 2, 2).setZero();
+
+        eigenut::TiledBlockMatrix<  eigenut::MatrixBlockSizeType::DYNAMIC,
+                                    eigenut::MatrixBlockSizeType::DYNAMIC,
+                                    eigenut::MatrixSparsityType::LEFT_LOWER_TRIANGULAR> llt_matrix(matrix, 2, 2);
+        BOOST_CHECK_EQUAL(llt_matrix.getRaw().size(), 24);
+        llt_matrix.evaluate(result);
+        BOOST_CHECK(result.isApprox(expected_result));
+        BOOST_CHECK((llt_matrix * right).isApprox(expected_result * right));
+        BOOST_CHECK((left * llt_matrix).isApprox(left * expected_result));
+
+        llt_matrix(2, 0).setZero();
+        expected_result.block(4, 0, 2, 2).setZero();
+        BOOST_CHECK((llt_matrix * right).isApprox(expected_result * right));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(RowMajorStorage)
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 6);
+        const eigenut::DefaultDynamicRowMajorMatrix matrix_row_major = matrix;
+        const Eigen::MatrixXd vectors = Eigen::MatrixXd::Random(6, 2);
+        const std::ptrdiff_t identity_size = 3;
+
+
+        eigenut::GenericBlockMatrix<2, 3, double, Eigen::RowMajor> generic_matrix(matrix_row_major);
+        eigenut::GenericBlockMatrix<2, 3> generic_matrix_col_major(matrix);
+
+        BOOST_CHECK((generic_matrix * vectors).isApprox(matrix * vectors));
+        BOOST_CHECK(generic_matrix.row(1).isApprox(generic_matrix_col_major.row(1)));
+        BOOST_CHECK(generic_matrix(2, 1).isApprox(generic_matrix_col_major(2, 1)));
+        BOOST_CHECK(generic_matrix.selectRowInBlocksAsMap(1).isApprox(generic_matrix_col_major.selectRowInBlocksAsMap(1)));
+        BOOST_CHECK(generic_matrix.selectColumnInBlocksAsMap(2).isApprox(generic_matrix_col_major.selectColumnInBlocksAsMap(2)));
+        BOOST_CHECK(generic_matrix.selectRowInBlocksAsMatrix(1).isApprox(generic_matrix_col_major.selectRowInBlocksAsMatrix(1)));
+        BOOST_CHECK(generic_matrix.selectRowInBlocks(1).getRaw().isApprox(generic_matrix_col_major.selectRowInBlocks(1).getRaw()));
+
+        generic_matrix.selectRowInBlocksAsMap(0).setZero();
+        generic_matrix_col_major.selectRowInBlocksAsMap(0).setZero();
+        BOOST_CHECK(generic_matrix.getRaw().isApprox(generic_matrix_col_major.getRaw()));
+
+
+        eigenut::DiagonalBlockMatrix<2, 2, double, Eigen::RowMajor> diagonal_matrix(matrix_row_major);
+        eigenut::DiagonalBlockMatrix<2, 2> diagonal_matrix_col_major(matrix);
+        BOOST_CHECK((diagonal_matrix * vectors).isApprox(diagonal_matrix_col_major * vectors));
+        BOOST_CHECK(diagonal_matrix(1).isApprox(diagonal_matrix_col_major(1)));
+
+        Eigen::SparseMatrix<double> sparse;
+        Eigen::SparseMatrix<double> sparse_col_major;
+        diagonal_matrix.toSparse(sparse);
+        diagonal_matrix_col_major.toSparse(sparse_col_major);
+        BOOST_CHECK(Eigen::MatrixXd(sparse).isApprox(Eigen::MatrixXd(sparse_col_major)));
+
+
+        eigenut::LeftLowerTriangularBlockMatrix<eigenut::MatrixBlockSizeType::DYNAMIC, 3, double, Eigen::RowMajor>
+            triangular_matrix(matrix_row_major, 3);
+        eigenut::LeftLowerTriangularBlockMatrix<3, 3> triangular_matrix_col_major(matrix);
+        BOOST_CHECK((triangular_matrix * vectors).isApprox(triangular_matrix_col_major * vectors));
+
+
+        eigenut::ConstBlockMatrixInterface<3, 3, eigenut::MatrixSparsityType::NONE, double, Eigen::RowMajor> interface(matrix_row_major);
+        BOOST_CHECK((interface * vectors).isApprox(matrix * vectors));
+
+
+        eigenut::GenericBlockKroneckerProduct<2, 3, double, Eigen::RowMajor> kronecker(matrix_row_major, identity_size);
+        eigenut::GenericBlockKroneckerProduct<2, 3> kronecker_col_major(matrix, identity_size);
+        Eigen::VectorXd result;
+        const Eigen::VectorXd kronecker_vector = Eigen::VectorXd::Random(matrix.cols() * identity_size);
+        kronecker.multiplyRight(result, kronecker_vector);
+        BOOST_CHECK(result.isApprox(kronecker_col_major.evaluate() * kronecker_vector));
+
+
+        const eigenut::SelectionMatrix selector(2, 1);
+        BOOST_CHECK((selector * matrix_row_major).isApprox(selector * matrix));
+        BOOST_CHECK(eigenut::selectColumns(matrix_row_major, 2, 1).isApprox(eigenut::selectColumns(matrix, 2, 1)));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(BatchedBlockMatrix)
+    {
+        const std::ptrdiff_t batch_size = 5;
+        const std::ptrdiff_t identity_size = 3;
+
+        eigenut::BatchedBlockMatrix<2, 3, eigenut::MatrixSparsityType::NONE> generic_batch;
+        eigenut::BatchedBlockMatrix<3, 3, eigenut::MatrixSparsityType::LEFT_LOWER_TRIANGULAR> triangular_batch;
+        eigenut::BatchedBlockMatrix<eigenut::MatrixBlockSizeType::DYNAMIC, 3, eigenut::MatrixSparsityType::DIAGONAL>
+            diagonal_batch(2);
+        std::vector<Eigen::MatrixXd> matrices(batch_size);
+        const Eigen::MatrixXd vectors = Eigen::MatrixXd::Random(batch_size, 9);
+        const Eigen::MatrixXd kronecker_vectors = Eigen::MatrixXd::Random(batch_size, 9*identity_size);
+
+        generic_batch.setZero(batch_size, 3, 3);
+        triangular_batch.setZero(batch_size, 3);
+        diagonal_batch.setZero(batch_size, 3);
+        for (std::ptrdiff_t k = 0; k < batch_size; ++k)
+        {
+            matrices[k] = Eigen::MatrixXd::Random(6, 9);
+            generic_batch.set(k, matrices[k]);
+            triangular_batch.set(k, Eigen::MatrixXd::Random(9, 9));
+            diagonal_batch.set(k, matrices[k]);
+        }
+        BOOST_CHECK_EQUAL(generic_batch.getBatchSize(), batch_size);
+
+
+        Eigen::MatrixXd result;
+        Eigen::MatrixXd result_kronecker;
+        Eigen::MatrixXd result_ata;
+        Eigen::MatrixXd dense;
+
+        generic_batch.multiplyRight(result, vectors);
+        generic_batch.multiplyRightKronecker(result_kronecker, kronecker_vectors, identity_size);
+        generic_batch.getATA(result_ata);
+        for (std::ptrdiff_t k = 0; k < batch_size; ++k)
+        {
+            generic_batch.evaluate(dense, k);
+            BOOST_CHECK(dense.isApprox(matrices[k]));
+            BOOST_CHECK(result.row(k).transpose().isApprox(matrices[k] * vectors.row(k).transpose()));
+
+            const eigenut::GenericBlockKroneckerProduct<2, 3> kronecker(matrices[k], identity_size);
+            BOOST_CHECK(result_kronecker.row(k).transpose().isApprox(
+                        kronecker.evaluate() * kronecker_vectors.row(k).transpose()));
+
+            const Eigen::MatrixXd ata = matrices[k].transpose() * matrices[k];
+            BOOST_CHECK(Eigen::Map<const Eigen::MatrixXd>(result_ata.row(k).eval().data(), 9, 9).isApprox(ata));
+        }
+
+
+        triangular_batch.multiplyRight(result, vectors);
+        triangular_batch.getATA(result_ata);
+        for (std::ptrdiff_t k = 0; k < batch_size; ++k)
+        {
+            triangular_batch.evaluate(dense, k);
+            BOOST_CHECK(dense.topRightCorner(3, 6).isZero());
+            BOOST_CHECK(result.row(k).transpose().isApprox(dense * vectors.row(k).transpose()));
+
+            const Eigen::MatrixXd ata = dense.transpose() * dense;
+            BOOST_CHECK(Eigen::Map<const Eigen::MatrixXd>(result_ata.row(k).eval().data(), 9, 9).isApprox(ata));
+        }
+
+
+        diagonal_batch.multiplyRight(result, vectors);
+        for (std::ptrdiff_t k = 0; k < batch_size; ++k)
+        {
+            diagonal_batch.evaluate(dense, k);
+            const eigenut::DiagonalBlockMatrix<eigenut::MatrixBlockSizeType::DYNAMIC, 3> diagonal(matrices[k], 2);
+            Eigen::MatrixXd expected_result;
+            diagonal.multiplyRight(expected_result, vectors.row(k).transpose());
+            BOOST_CHECK(result.row(k).transpose().isApprox(expected_result));
+            BOOST_CHECK(dense.topRightCorner(2, 6).isZero());
+        }
+    }
+
+
+    BOOST_AUTO_TEST_CASE(DispatchedBlockSizes)
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(12, 12);
+        const Eigen::MatrixXd vectors = Eigen::MatrixXd::Random(12, 2);
+        const Eigen::MatrixXd vectors_transposed = vectors.transpose();
+        Eigen::MatrixXd result;
+        Eigen::MatrixXd expected_result;
+
+
+        // dispatched to a fixed size kernel
+        const eigenut::DiagonalBlockMatrix<3, 3> static_matrix(matrix);
+        const eigenut::DiagonalBlockMatrix<eigenut::MatrixBlockSizeType::DYNAMIC, eigenut::MatrixBlockSizeType::DYNAMIC>
+            dynamic_matrix(matrix, 3, 3);
+
+        static_matrix.multiplyRight(expected_result, vectors);
+        dynamic_matrix.multiplyRight(result, vectors);
+        BOOST_CHECK(result.isApprox(expected_result));
+
+        static_matrix.multiplyLeft(expected_result, vectors_transposed);
+        dynamic_matrix.multiplyLeft(result, vectors_transposed);
+        BOOST_CHECK(result.isApprox(expected_result));
+
+
+        // one static dimension
+        const eigenut::DiagonalBlockMatrix<4, 3> static_rectangular_matrix(matrix.leftCols(9));
+        const eigenut::DiagonalBlockMatrix<4, eigenut::MatrixBlockSizeType::DYNAMIC>
+            partially_dynamic_matrix(matrix.leftCols(9), eigenut::MatrixBlockSizeType::UNDEFINED, 3);
+
+        static_rectangular_matrix.multiplyRight(expected_result, vectors.topRows(9));
+        partially_dynamic_matrix.multiplyRight(result, vectors.topRows(9));
+        BOOST_CHECK(result.isApprox(expected_result));
+
+
+        // sizes not listed in the default EIGENUT_DISPATCHED_BLOCK_SIZES
+        const eigenut::DiagonalBlockMatrix<eigenut::MatrixBlockSizeType::DYNAMIC, eigenut::MatrixBlockSizeType::DYNAMIC>
+            rectangular_matrix(matrix.leftCols(9), 4, 3);
+        rectangular_matrix.multiplyRight(result, vectors.topRows(9));
+        BOOST_CHECK(result.isApprox(expected_result));
+
+        const eigenut::DiagonalBlockMatrix<eigenut::MatrixBlockSizeType::DYNAMIC, eigenut::MatrixBlockSizeType::DYNAMIC>
+            unlisted_matrix(matrix.topLeftCorner(10, 10), 5, 5);
+        expected_result = Eigen::MatrixXd::Zero(10, 10);
+        expected_result.topLeftCorner(5, 5) = matrix.topLeftCorner(5, 5);
+        expected_result.block(5, 5, 5, 5) = matrix.block(5, 5, 5, 5);
+        unlisted_matrix.multiplyRight(result, vectors.topRows(10));
+        BOOST_CHECK(result.isApprox(expected_result * vectors.topRows(10)));
+
+
+        // Kronecker products: gather / scatter of blocks and Gram matrix
+        const std::ptrdiff_t identity_size = 4;
+        const Eigen::VectorXd vector = Eigen::VectorXd::Random(matrix.cols() * identity_size);
+        Eigen::VectorXd vector_result;
+
+        const eigenut::GenericBlockKroneckerProduct<eigenut::MatrixBlockSizeType::DYNAMIC, eigenut::MatrixBlockSizeType::DYNAMIC>
+            dynamic_kronecker(matrix, identity_size, 3, 3);
+        expected_result = dynamic_kronecker.evaluate() * vector;
+        dynamic_kronecker.multiplyRightReshaped(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(expected_result, 1e-12));
+        dynamic_kronecker.multiplyRightSegmentwise(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(expected_result, 1e-12));
+
+        const Eigen::MatrixXd triangular_matrix = matrix.triangularView<Eigen::Lower>();
+        const eigenut::LeftLowerTriangularBlockKroneckerProduct<2, 2> static_llt_kronecker(triangular_matrix, identity_size);
+        const eigenut::LeftLowerTriangularBlockKroneckerProduct<eigenut::MatrixBlockSizeType::DYNAMIC, eigenut::MatrixBlockSizeType::DYNAMIC>
+            dynamic_llt_kronecker(triangular_matrix, identity_size, 2, 2);
+        expected_result = static_llt_kronecker.evaluate() * vector;
+        dynamic_llt_kronecker.multiplyRightReshaped(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(expected_result, 1e-12));
+
+        static_llt_kronecker.getATA(expected_result);
+        dynamic_llt_kronecker.getATA(result);
+        BOOST_CHECK(result.triangularView<Eigen::Lower>().toDenseMatrix().isApprox(
+                        expected_result.triangularView<Eigen::Lower>().toDenseMatrix(), 1e-12));
+    }
 }
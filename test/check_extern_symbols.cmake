@@ -0,0 +1,22 @@
+# Checks that an object file references DiagonalBlocksDispatcher kernels
+# without defining them, i.e., the kernels are resolved from the library.
+#
+# Parameters: NM -- nm executable, OBJECT -- object file.
+
+execute_process(COMMAND "${NM}" -C "${OBJECT}"
+                OUTPUT_VARIABLE SYMBOLS
+                RESULT_VARIABLE RESULT)
+if (NOT RESULT EQUAL 0)
+    message(FATAL_ERROR "Failed to list symbols of '${OBJECT}'.")
+endif()
+
+string(REGEX MATCHALL "[^\n]*DiagonalBlocksDispatcher<[^\n]*>::multiply[^\n]*" KERNELS "${SYMBOLS}")
+if (NOT KERNELS)
+    message(FATAL_ERROR "No references to DiagonalBlocksDispatcher kernels in '${OBJECT}'.")
+endif()
+
+foreach(KERNEL ${KERNELS})
+    if (NOT KERNEL MATCHES "^ +U ")
+        message(FATAL_ERROR "Kernel is instantiated in '${OBJECT}' instead of the library: ${KERNEL}")
+    endif()
+endforeach()
@@ -0,0 +1,65 @@
+/**
+    @file
+    @author  Alexander Sherikov
+    @copyright 2019 Alexander Sherikov. Licensed under the Apache License, Version 2.0.
+    (see @ref LICENSE or http://www.apache.org/licenses/LICENSE-2.0)
+
+    @brief
+*/
+
+#include <eigenut/all.h>
+#include "utf_common.h"
+
+
+namespace
+{
+    template<typename t_Scalar, int t_block_size>
+        void checkDiagonalProducts(const std::ptrdiff_t block_size)
+    {
+        typedef Eigen::Matrix<t_Scalar, Eigen::Dynamic, Eigen::Dynamic> Matrix;
+        typedef Eigen::Matrix<t_Scalar, Eigen::Dynamic, 1>              Vector;
+
+        const std::ptrdiff_t num_blocks = 4;
+        const std::ptrdiff_t size = num_blocks * block_size;
+
+        const Matrix blocks = Matrix::Random(size, size);
+        const Matrix matrix = Matrix::Random(size, 5);
+        const Vector vector = Vector::Random(size);
+
+        Matrix dense = Matrix::Zero(size, size);
+        for (std::ptrdiff_t i = 0; i < num_blocks; ++i)
+        {
+            dense.block(i*block_size, i*block_size, block_size, block_size) =
+                blocks.block(i*block_size, i*block_size, block_size, block_size);
+        }
+
+        const std::ptrdiff_t dynamic_block_size =
+            (eigenut::MatrixBlockSizeType::DYNAMIC == t_block_size)
+            ? block_size
+            : static_cast<std::ptrdiff_t>(eigenut::MatrixBlockSizeType::UNDEFINED);
+        const eigenut::DiagonalBlockMatrix<t_block_size, t_block_size, t_Scalar>
+            block_matrix(dense, dynamic_block_size, dynamic_block_size);
+
+        Matrix result;
+        block_matrix.multiplyRight(result, matrix);
+        BOOST_CHECK(result.isApprox(dense * matrix));
+
+        Vector vector_result;
+        block_matrix.multiplyRight(vector_result, vector);
+        BOOST_CHECK(vector_result.isApprox(dense * vector));
+
+        const Matrix matrix_transposed = matrix.transpose();
+        block_matrix.multiplyLeft(result, matrix_transposed);
+        BOOST_CHECK(result.isApprox(matrix_transposed * dense));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(InstantiatedKernels)
+    {
+        checkDiagonalProducts<double, 3>(3);
+        checkDiagonalProducts<double, eigenut::MatrixBlockSizeType::DYNAMIC>(3);
+        checkDiagonalProducts<double, eigenut::MatrixBlockSizeType::DYNAMIC>(5);
+        checkDiagonalProducts<float, 6>(6);
+        checkDiagonalProducts<float, eigenut::MatrixBlockSizeType::DYNAMIC>(6);
+    }
+}
@@ -46,6 +46,52 @@ namespace
 
         eigenut::concatenateMatricesVertically(result, matrices);
         BOOST_REQUIRE(result.isApprox(match,  1e-8));
+
+        // consecutive empty matrices
+        matrices.insert(matrices.begin() + 2, c);
+        eigenut::concatenateMatricesVertically(result, matrices);
+        BOOST_REQUIRE(result.isApprox(match,  1e-8));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(ConcatenateMatrixVerticallyViews)
+    {
+        Eigen::MatrixXd storage = Eigen::MatrixXd::Random(7, 3);
+
+        std::vector< Eigen::Map<const Eigen::MatrixXd> > views;
+        views.push_back(Eigen::Map<const Eigen::MatrixXd>(storage.data(), 0, 0));
+        views.push_back(Eigen::Map<const Eigen::MatrixXd>(storage.data(), 7, 1));
+        views.push_back(Eigen::Map<const Eigen::MatrixXd>(storage.data() + 7, 0, 0));
+        views.push_back(Eigen::Map<const Eigen::MatrixXd>(storage.data() + 7, 7, 1));
+        views.push_back(Eigen::Map<const Eigen::MatrixXd>(storage.data() + 14, 7, 1));
+
+        Eigen::Map<const Eigen::MatrixXd> match(storage.data(), 21, 1);
+
+        Eigen::MatrixXd result;
+        eigenut::concatenateMatricesVertically(result, views.begin(), views.end());
+        BOOST_CHECK(result.isApprox(match, 1e-12));
+
+        eigenut::concatenateMatricesVertically(result, views.begin(), views.begin());
+        BOOST_CHECK_EQUAL(result.size(), 0);
+
+
+        std::vector<Eigen::MatrixXd> matrices;
+        matrices.push_back(Eigen::MatrixXd::Random(2, 4));
+        matrices.push_back(Eigen::MatrixXd());
+        matrices.push_back(Eigen::MatrixXd::Random(3, 4));
+
+        eigenut::VerticallyStackedMatrices< std::vector<Eigen::MatrixXd> > stacked(matrices);
+        Eigen::MatrixXd stacked_match;
+        stacked.evaluate(stacked_match);
+        BOOST_CHECK_EQUAL(stacked.getNumberOfRows(), 5);
+        BOOST_CHECK_EQUAL(stacked.getNumberOfColumns(), 4);
+
+        Eigen::MatrixXd right = Eigen::MatrixXd::Random(4, 2);
+        Eigen::MatrixXd left = Eigen::MatrixXd::Random(3, 5);
+        result = stacked * right;
+        BOOST_CHECK(result.isApprox(stacked_match * right, 1e-12));
+        result = left * stacked;
+        BOOST_CHECK(result.isApprox(left * stacked_match, 1e-12));
     }
 
 
@@ -108,5 +154,622 @@ namespace
 
         eigenut::concatenateMatricesHorizontally(result, b, d, e);
         BOOST_REQUIRE(result.isApprox(match,  1e-8));
+
+        eigenut::concatenateMatricesHorizontally(result, a, d, c);
+        BOOST_REQUIRE(result.isApprox(d,  1e-8));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(ConcatenateMatrixHorizontallyMany)
+    {
+        Eigen::MatrixXd storage = Eigen::MatrixXd::Random(3, 2*EIGENUT_PARALLEL_COPY_MIN_SIZE / 3 + 10);
+
+        // views of parts of the storage, some of them are wider than a
+        // chunk of columns copied at once
+        std::vector< Eigen::Map<const Eigen::MatrixXd> > views;
+        std::ptrdiff_t col_index = 0;
+        for (std::ptrdiff_t width = 0; col_index < storage.cols(); width = 1 + 7 * width)
+        {
+            const std::ptrdiff_t size = std::min(width, storage.cols() - col_index);
+            views.push_back(Eigen::Map<const Eigen::MatrixXd>(storage.col(col_index).data(), 3, size));
+            col_index += size;
+        }
+
+        Eigen::MatrixXd result;
+        eigenut::concatenateMatricesHorizontally(result, views);
+        BOOST_CHECK(result == storage);
+
+        views.clear();
+        eigenut::concatenateMatricesHorizontally(result, views);
+        BOOST_CHECK_EQUAL(result.size(), 0);
+
+#if __cplusplus >= 201103L
+        Eigen::MatrixXd a = Eigen::MatrixXd::Random(2, 1);
+        Eigen::MatrixXd b = Eigen::MatrixXd::Random(2, 3);
+        Eigen::MatrixXd match(2, 8);
+        match << a, b, Eigen::MatrixXd::Identity(2, 2), a, a;
+
+        eigenut::concatenateMatricesHorizontally(result, a, Eigen::MatrixXd(), b, Eigen::MatrixXd::Identity(2, 2), a, a);
+        BOOST_CHECK(result == match);
+#endif
+    }
+
+
+    void checkGramMatrix(const Eigen::MatrixXd &A)
+    {
+        Eigen::MatrixXd match = A.transpose() * A;
+        match = match.triangularView<Eigen::Lower>();
+
+        Eigen::MatrixXd result;
+        Eigen::MatrixXd result_columnwise;
+        Eigen::MatrixXd result_panelwise;
+
+        eigenut::getATA(result, A);
+        eigenut::getATAColumnwise(result_columnwise, A);
+        result_panelwise.setZero(A.cols(), A.cols());
+        eigenut::addATAPanelwise(result_panelwise, A);
+        result = result.triangularView<Eigen::Lower>();
+        result_columnwise = result_columnwise.triangularView<Eigen::Lower>();
+        result_panelwise = result_panelwise.triangularView<Eigen::Lower>();
+        BOOST_CHECK(result.isApprox(match, 1e-10));
+        BOOST_CHECK(result_columnwise.isApprox(match, 1e-10));
+        BOOST_CHECK(result_panelwise.isApprox(match, 1e-10));
+
+        eigenut::addATA(result, A);
+        eigenut::addATAColumnwise(result_columnwise, A);
+        result = result.triangularView<Eigen::Lower>();
+        result_columnwise = result_columnwise.triangularView<Eigen::Lower>();
+        BOOST_CHECK(result.isApprox(2 * match, 1e-10));
+        BOOST_CHECK(result_columnwise.isApprox(2 * match, 1e-10));
+
+
+        const std::ptrdiff_t offset = 5;
+        const std::ptrdiff_t num_el = A.cols() + 2*offset;
+
+        eigenut::getATA(result, A, offset, num_el);
+        BOOST_CHECK_EQUAL(result.rows(), num_el);
+        result = result.triangularView<Eigen::Lower>();
+        BOOST_CHECK(result.block(offset, offset, A.cols(), A.cols()).isApprox(match, 1e-10));
+        BOOST_CHECK(result.topRows(offset).isZero());
+        BOOST_CHECK(result.bottomRows(offset).isZero());
+
+        eigenut::addATA(result, A, offset);
+        result = result.triangularView<Eigen::Lower>();
+        BOOST_CHECK(result.block(offset, offset, A.cols(), A.cols()).isApprox(2 * match, 1e-10));
+        BOOST_CHECK(result.bottomRows(offset).isZero());
+    }
+
+
+    BOOST_AUTO_TEST_CASE(GramMatrix)
+    {
+        // column by column
+        checkGramMatrix(Eigen::MatrixXd::Random(100, 10));
+        // several panels, the last one is incomplete
+        checkGramMatrix(Eigen::MatrixXd::Random(300, 2*EIGENUT_ATA_PANEL_SIZE + 7));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(GramMatrixBatch)
+    {
+        std::vector<std::ptrdiff_t> offsets;
+        std::vector<std::ptrdiff_t> sizes;
+        std::vector< std::vector<std::size_t> > groups;
+
+        offsets.push_back(4);   sizes.push_back(3);
+        offsets.push_back(0);   sizes.push_back(5);
+        offsets.push_back(5);   sizes.push_back(0);
+        offsets.push_back(5);   sizes.push_back(2);
+        offsets.push_back(1);   sizes.push_back(2);
+
+        eigenut::getNonOverlappingGroups(groups, offsets, sizes);
+        BOOST_REQUIRE_EQUAL(groups.size(), 2);
+        BOOST_REQUIRE_EQUAL(groups[0].size(), 2);
+        BOOST_CHECK_EQUAL(groups[0][0], 1);
+        BOOST_CHECK_EQUAL(groups[0][1], 3);
+        BOOST_REQUIRE_EQUAL(groups[1].size(), 2);
+        BOOST_CHECK_EQUAL(groups[1][0], 4);
+        BOOST_CHECK_EQUAL(groups[1][1], 0);
+
+
+        const std::ptrdiff_t num_el = 100;
+        std::vector<Eigen::MatrixXd> matrices;
+        offsets.clear();
+        for (std::ptrdiff_t i = 0; i < 200; ++i)
+        {
+            const std::ptrdiff_t size = 3 + i % 7;
+            matrices.push_back(Eigen::MatrixXd::Random(2 + i % 5, size));
+            offsets.push_back((i * 37) % (num_el - size + 1));
+        }
+
+        Eigen::MatrixXd match = Eigen::MatrixXd::Zero(num_el, num_el);
+        for (std::size_t i = 0; i < matrices.size(); ++i)
+        {
+            eigenut::addATA(match, matrices[i], offsets[i]);
+        }
+        match = match.triangularView<Eigen::Lower>();
+
+        Eigen::MatrixXd result = Eigen::MatrixXd::Zero(num_el, num_el);
+        eigenut::addATA(result, matrices, offsets);
+        result = result.triangularView<Eigen::Lower>();
+        BOOST_CHECK(result.isApprox(match, 1e-10));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(WeightedGramMatrix)
+    {
+        const std::ptrdiff_t sizes[] = {10, 2*EIGENUT_ATA_PANEL_SIZE + 7};
+
+        for (std::size_t k = 0; k < sizeof(sizes) / sizeof(sizes[0]); ++k)
+        {
+            Eigen::MatrixXd A = Eigen::MatrixXd::Random(150, sizes[k]);
+            Eigen::VectorXd weights = Eigen::VectorXd::Random(A.rows());
+            Eigen::MatrixXd match;
+            Eigen::MatrixXd result;
+
+
+            match = 0.5 * A.transpose() * A;
+            match = match.triangularView<Eigen::Lower>();
+
+            eigenut::getATWA(result, A, 0.5);
+            result = result.triangularView<Eigen::Lower>();
+            BOOST_CHECK(result.isApprox(match, 1e-10));
+
+
+            match = A.transpose() * weights.asDiagonal() * A;
+            match = match.triangularView<Eigen::Lower>();
+
+            eigenut::getATWA(result, A, weights);
+            result = result.triangularView<Eigen::Lower>();
+            BOOST_CHECK(result.isApprox(match, 1e-10));
+
+            eigenut::addATWA(result, A, weights);
+            result = result.triangularView<Eigen::Lower>();
+            BOOST_CHECK(result.isApprox(2 * match, 1e-10));
+
+
+            const std::ptrdiff_t offset = 3;
+            const std::ptrdiff_t num_el = A.cols() + 2*offset;
+
+            eigenut::getATWA(result, A, weights, offset, num_el);
+            eigenut::addATWA(result, A, weights, offset);
+            result = result.triangularView<Eigen::Lower>();
+            BOOST_CHECK(result.block(offset, offset, A.cols(), A.cols()).isApprox(2 * match, 1e-10));
+            BOOST_CHECK(result.topRows(offset).isZero());
+            BOOST_CHECK(result.bottomRows(offset).isZero());
+
+
+            eigenut::DiagonalBlockMatrix<3, 3> block_weights(Eigen::MatrixXd::Zero(A.rows(), A.rows()));
+            for (std::ptrdiff_t i = 0; i < block_weights.getNumberOfBlocksVertical(); ++i)
+            {
+                block_weights(i).setRandom();
+            }
+            match = A.transpose() * block_weights.getRaw() * A;
+            match = match.triangularView<Eigen::Lower>();
+
+            eigenut::getATWA(result, A, block_weights);
+            result = result.triangularView<Eigen::Lower>();
+            BOOST_CHECK(result.isApprox(match, 1e-10));
+        }
+    }
+
+
+    BOOST_AUTO_TEST_CASE(RemoveRowsColumns)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(10, 8);
+        Eigen::MatrixXd match;
+        Eigen::MatrixXd result;
+
+        eigenut::IndexVector indices(4);
+        indices << 0, 3, 4, 9;
+
+
+        match = matrix;
+        for (std::ptrdiff_t i = indices.size() - 1; i >= 0; --i)
+        {
+            eigenut::removeRow(match, indices[i]);
+        }
+        result = matrix;
+        eigenut::removeRows(result, indices);
+        BOOST_CHECK(result == match);
+
+        result = matrix;
+        BOOST_CHECK_EQUAL(eigenut::removeRowsInPlace(result, indices), 6);
+        BOOST_CHECK_EQUAL(result.rows(), 10);
+        BOOST_CHECK(result.topRows(6) == match);
+
+
+        indices.conservativeResize(3);
+        match = matrix;
+        for (std::ptrdiff_t i = indices.size() - 1; i >= 0; --i)
+        {
+            eigenut::removeColumn(match, indices[i]);
+        }
+        result = matrix;
+        eigenut::removeColumns(result, indices);
+        BOOST_CHECK(result == match);
+
+        result = matrix;
+        BOOST_CHECK_EQUAL(eigenut::removeColumnsInPlace(result, indices), 5);
+        BOOST_CHECK_EQUAL(result.cols(), 8);
+        BOOST_CHECK(result.leftCols(5) == match);
+
+
+        result = matrix;
+        eigenut::removeColumns(result, eigenut::IndexVector());
+        BOOST_CHECK(result == matrix);
+    }
+
+
+    BOOST_AUTO_TEST_CASE(GrowableMatrix)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(6, 4);
+        Eigen::MatrixXd match;
+
+        eigenut::GrowableMatrix<double> growable(2, 4);
+
+        for (std::ptrdiff_t i = 0; i < matrix.rows(); ++i)
+        {
+            growable.appendRows(matrix.row(i));
+        }
+        BOOST_CHECK_EQUAL(growable.getNumberOfRows(), 6);
+        BOOST_CHECK_EQUAL(growable.getRowsCapacity(), 8);
+        BOOST_CHECK(growable.getMatrix() == matrix);
+
+
+        const double *data = growable.getMatrix().data();
+
+        match = matrix;
+        eigenut::removeRow(match, 1);
+        eigenut::removeRow(growable, 1);
+        BOOST_CHECK(growable.getMatrix() == match);
+
+        match.row(0) = match.row(4);
+        eigenut::removeRow(match, 4);
+        growable.swapRemoveRow(0);
+        BOOST_CHECK(growable.getMatrix() == match);
+
+        match.col(1) = match.col(3);
+        eigenut::removeColumn(match, 3);
+        growable.swapRemoveColumn(1);
+        BOOST_CHECK(growable.getMatrix() == match);
+
+        eigenut::IndexVector indices(2);
+        indices << 0, 2;
+        eigenut::removeRows(match, indices);
+        eigenut::removeRows(growable, indices);
+        BOOST_CHECK(growable.getMatrix() == match);
+
+        growable.appendRows(matrix.topLeftCorner(1, 3));
+        growable.appendColumns(Eigen::VectorXd::Ones(3));
+        BOOST_CHECK_EQUAL(growable.getNumberOfRows(), 3);
+        BOOST_CHECK_EQUAL(growable.getNumberOfColumns(), 4);
+        BOOST_CHECK(growable.getMatrix().topLeftCorner(2, 3) == match);
+        BOOST_CHECK(growable.getMatrix().bottomLeftCorner(1, 3) == matrix.topLeftCorner(1, 3));
+        BOOST_CHECK(growable.getMatrix().col(3) == Eigen::VectorXd::Ones(3));
+
+        BOOST_CHECK(growable.getMatrix().data() == data);
+
+
+        eigenut::concatenateMatricesVertically(growable, matrix, matrix);
+        match.resize(12, 4);
+        match << matrix, matrix;
+        BOOST_CHECK(growable.getMatrix() == match);
+
+        eigenut::concatenateMatricesHorizontally(growable, matrix, matrix);
+        eigenut::concatenateMatricesHorizontally(match, matrix, matrix);
+        BOOST_CHECK(growable.getMatrix() == match);
+
+        growable.shrinkToFit();
+        BOOST_CHECK_EQUAL(growable.getRowsCapacity(), 6);
+        BOOST_CHECK_EQUAL(growable.getColumnsCapacity(), 8);
+        BOOST_CHECK(growable.getMatrix() == match);
+    }
+
+
+    BOOST_AUTO_TEST_CASE(GrowableMatrixEmpty)
+    {
+        const Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(3, 5);
+        Eigen::MatrixXd match;
+
+        eigenut::GrowableMatrix<double> rows;
+        rows.appendRows(Eigen::RowVector3d(1, 2, 3));
+        rows.appendRows(Eigen::RowVector3d(4, 5, 6));
+        match.resize(2, 3);
+        match << 1, 2, 3, 4, 5, 6;
+        BOOST_CHECK(rows.getMatrix() == match);
+
+        eigenut::GrowableMatrix<double> columns;
+        columns.appendColumns(Eigen::Vector3d(1, 2, 3));
+        BOOST_CHECK(columns.getMatrix() == Eigen::Vector3d(1, 2, 3));
+
+        // wider / taller than the capacity after clear()
+        rows.clear();
+        rows.appendRows(matrix);
+        BOOST_CHECK(rows.getMatrix() == matrix);
+
+        columns.clear();
+        columns.appendColumns(matrix.transpose());
+        BOOST_CHECK(columns.getMatrix() == matrix.transpose());
+
+        eigenut::GrowableMatrix<double> vertical;
+        eigenut::concatenateMatricesVertically(vertical, matrix, matrix);
+        match.resize(6, 5);
+        match << matrix, matrix;
+        BOOST_CHECK(vertical.getMatrix() == match);
+
+        eigenut::GrowableMatrix<double> horizontal(1, 1);
+        eigenut::concatenateMatricesHorizontally(horizontal, matrix, matrix);
+        eigenut::concatenateMatricesHorizontally(match, matrix, matrix);
+        BOOST_CHECK(horizontal.getMatrix() == match);
+    }
+
+
+    BOOST_AUTO_TEST_CASE(SelectionMatrix)
+    {
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(9, 3);
+        Eigen::MatrixXd match;
+        Eigen::MatrixXd result;
+
+        eigenut::IndexVector indices(3);
+
+
+        // regular step
+        indices << 1, 4, 7;
+        eigenut::SelectionMatrix regular(indices);
+        BOOST_CHECK(regular.isRegular());
+
+        match.resize(3, 3);
+        match << matrix.row(1), matrix.row(4), matrix.row(7);
+
+        result = regular * matrix;
+        BOOST_CHECK(result == match);
+        result = eigenut::SelectionMatrix(3, 1) * matrix;
+        BOOST_CHECK(result == match);
+        regular.multiplyRight(result, matrix);
+        BOOST_CHECK(result == match);
+
+        indices << 0, 1, 2;
+        result = eigenut::SelectionMatrix(indices) * matrix;
+        BOOST_CHECK(result == matrix.topRows(3));
+
+
+        // arbitrary selection
+        indices << 5, 0, 5;
+        eigenut::SelectionMatrix arbitrary(indices);
+        BOOST_CHECK(!arbitrary.isRegular());
+
+        match << matrix.row(5), matrix.row(0), matrix.row(5);
+        arbitrary.multiplyRight(result, matrix);
+        BOOST_CHECK(result == match);
+        // irregular selections must not be mapped, even in release builds
+        BOOST_CHECK_THROW(result = arbitrary * matrix, std::runtime_error);
+
+
+        // scatter-add
+        Eigen::MatrixXd reduced = Eigen::MatrixXd::Random(3, 3);
+
+        match = matrix;
+        match.row(5) += reduced.row(0) + reduced.row(2);
+        match.row(0) += reduced.row(1);
+        result = matrix;
+        arbitrary.addTransposedMultiplyRight(result, reduced);
+        BOOST_CHECK(result.isApprox(match));
+
+        match = matrix;
+        match.row(1) += reduced.row(0);
+        match.row(4) += reduced.row(1);
+        match.row(7) += reduced.row(2);
+        result = matrix;
+        regular.addTransposedMultiplyRight(result, reduced);
+        BOOST_CHECK(result.isApprox(match));
+
+        result = matrix;
+        eigenut::SelectionMatrix(3, 1).addTransposedMultiplyRight(result, reduced);
+        BOOST_CHECK(result.isApprox(match));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(TransformPoints)
+    {
+        const std::ptrdiff_t number_of_points = 1000;
+
+        Eigen::Matrix3d rotation = Eigen::Quaterniond::UnitRandom().toRotationMatrix();
+        Eigen::Vector3d translation = Eigen::Vector3d::Random();
+
+        Eigen::MatrixXd points = Eigen::MatrixXd::Random(3, number_of_points);
+        Eigen::MatrixXd match = eigenut::transform(points, rotation, translation);
+        Eigen::MatrixXd result(3, number_of_points);
+
+        eigenut::transform(result, points, rotation, translation);
+        BOOST_CHECK(result.isApprox(match));
+
+        eigenut::transform(result.leftCols(5), points.leftCols(5), rotation, translation);
+        BOOST_CHECK(result.isApprox(match));
+
+        result = points;
+        eigenut::transform(result, result, rotation, translation);
+        BOOST_CHECK(result.isApprox(match));
+
+
+        // structure of arrays
+        Eigen::MatrixXd points_soa = points.transpose();
+        Eigen::MatrixXd match_soa = match.transpose();
+
+        result.resize(number_of_points, 3);
+        eigenut::transformSoA(result, points_soa, rotation, translation);
+        BOOST_CHECK(result.isApprox(match_soa));
+
+        result = points_soa;
+        eigenut::transformSoA(result, result, rotation, translation);
+        BOOST_CHECK(result.isApprox(match_soa));
+
+
+        // multiple poses
+        std::vector<Eigen::Matrix3d> rotations(3, rotation);
+        std::vector<Eigen::Vector3d> translations(3, translation);
+        rotations[1] = Eigen::Matrix3d::Identity();
+        translations[2].setZero();
+
+        std::vector<Eigen::MatrixXd> results;
+        eigenut::transformSoA(results, points_soa, rotations, translations);
+        BOOST_REQUIRE_EQUAL(results.size(), 3);
+        BOOST_CHECK(results[0].isApprox(match_soa));
+        BOOST_CHECK(results[1].isApprox(points_soa.rowwise() + translation.transpose()));
+        BOOST_CHECK(results[2].isApprox(points_soa * rotation.transpose()));
+
+
+        // multiple sets of points
+        std::vector<Eigen::MatrixXd> point_sets(4);
+        point_sets[0] = points_soa;
+        point_sets[2] = points_soa.topRows(300);
+        point_sets[3] = points_soa.topRows(1);
+
+        eigenut::transformSoA(point_sets, rotation, translation);
+        BOOST_CHECK(point_sets[0].isApprox(match_soa));
+        BOOST_CHECK_EQUAL(point_sets[1].size(), 0);
+        BOOST_CHECK(point_sets[2].isApprox(match_soa.topRows(300)));
+        BOOST_CHECK(point_sets[3].isApprox(match_soa.topRows(1)));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(CrossProductMatrix)
+    {
+        eigenut::Vector3 vector = eigenut::Vector3::Random();
+        eigenut::CrossProductMatrix cross_product(vector);
+
+        Eigen::MatrixXd matrix_nx3 = Eigen::MatrixXd::Random(7, 3);
+        Eigen::MatrixXd matrix_3xn = Eigen::MatrixXd::Random(3, 7);
+        Eigen::MatrixXd result;
+
+        cross_product.multiplyLeft(result, matrix_nx3);
+        BOOST_CHECK(result.isApprox(matrix_nx3 * cross_product.eval()));
+        BOOST_CHECK(result.isApprox(matrix_nx3 * cross_product));
+
+        cross_product.addMultiplyLeft(result, matrix_nx3);
+        BOOST_CHECK(result.isApprox(2 * matrix_nx3 * cross_product.eval()));
+
+
+        cross_product.multiplyRight(result, matrix_3xn);
+        BOOST_CHECK(result.isApprox(cross_product.eval() * matrix_3xn));
+        BOOST_CHECK(result.isApprox(cross_product * matrix_3xn));
+        BOOST_CHECK(result.col(6).isApprox(vector.cross(eigenut::Vector3(matrix_3xn.col(6)))));
+
+        cross_product.addMultiplyRight(result, matrix_3xn);
+        BOOST_CHECK(result.isApprox(2 * cross_product.eval() * matrix_3xn));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(StackedCrossProductMatrix)
+    {
+        Eigen::MatrixXd vectors = Eigen::MatrixXd::Random(3, 5);
+        eigenut::StackedCrossProductMatrix<> cross_product(vectors);
+
+        Eigen::MatrixXd dense;
+        cross_product.evaluate(dense);
+        BOOST_CHECK_EQUAL(dense.rows(), 15);
+        BOOST_CHECK(dense.block(3, 3, 3, 3) == eigenut::CrossProductMatrix::eval(vectors.col(1)));
+        BOOST_CHECK(dense.block(0, 3, 3, 3).isZero());
+
+
+        Eigen::MatrixXd matrix = Eigen::MatrixXd::Random(15, 4);
+        BOOST_CHECK((cross_product * matrix).isApprox(dense * matrix));
+        BOOST_CHECK((matrix.transpose() * cross_product).isApprox(matrix.transpose() * dense));
+
+        Eigen::VectorXd vector = Eigen::VectorXd::Random(15);
+        BOOST_CHECK((cross_product * vector).isApprox(dense * vector));
+
+
+        eigenut::DiagonalBlockMatrix<3, 2> block_matrix;
+        block_matrix.setZero(5);
+        for (std::ptrdiff_t i = 0; i < 5; ++i)
+        {
+            block_matrix(i) = Eigen::MatrixXd::Random(3, 2);
+        }
+        BOOST_CHECK((cross_product * block_matrix).isApprox(dense * block_matrix.getRaw()));
+
+        eigenut::DiagonalBlockMatrix<2, 3> block_matrix_transposed(block_matrix.getRaw().transpose());
+        BOOST_CHECK((block_matrix_transposed * cross_product).isApprox(block_matrix_transposed.getRaw() * dense));
+    }
+
+
+    BOOST_AUTO_TEST_CASE(BlockDiagonal)
+    {
+        std::vector<eigenut::DefaultDynamicMatrix> blocks;
+        eigenut::DefaultDynamicMatrix dense;
+        eigenut::DefaultDynamicMatrix result;
+
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+            blocks.push_back(eigenut::DefaultDynamicMatrix::Random(2, 3));
+        }
+
+
+        eigenut::CompactBlockDiagonalMatrix<> compact;
+        eigenut::makeBlockDiagonal(compact, blocks);
+        dense = eigenut::makeBlockDiagonal(blocks);
+
+        BOOST_CHECK_EQUAL(compact.getNumberOfRows(), 6);
+        BOOST_CHECK_EQUAL(compact.getNumberOfColumns(), 9);
+        BOOST_CHECK_EQUAL(compact.getRaw().size(), 18);
+
+        compact.evaluate(result);
+        BOOST_CHECK(result.isApprox(dense));
+
+        eigenut::DefaultDynamicMatrix right = eigenut::DefaultDynamicMatrix::Random(9, 4);
+        eigenut::DefaultDynamicMatrix left = eigenut::DefaultDynamicMatrix::Random(5, 6);
+        BOOST_CHECK((compact * right).isApprox(dense * right));
+        BOOST_CHECK((left * compact).isApprox(left * dense));
+
+
+        eigenut::makeBlockDiagonal(compact, blocks[0], 4);
+        dense = eigenut::makeBlockDiagonal(blocks[0], 4);
+
+        BOOST_CHECK(compact.isRepeated());
+        BOOST_CHECK_EQUAL(compact.getRaw().size(), 6);
+
+        compact.evaluate(result);
+        BOOST_CHECK(result.isApprox(dense));
+
+        right.setRandom(12, 2);
+        left.setRandom(3, 8);
+        BOOST_CHECK((compact * right).isApprox(dense * right));
+        BOOST_CHECK((left * compact).isApprox(left * dense));
+
+
+        std::vector<eigenut::DefaultDynamicMatrix> empty_blocks(3, eigenut::DefaultDynamicMatrix(2, 0));
+        eigenut::makeBlockDiagonal(compact, empty_blocks);
+        BOOST_CHECK_EQUAL(compact.getNumberOfRows(), 6);
+        BOOST_CHECK_EQUAL(compact.getNumberOfColumns(), 0);
+
+        compact.evaluate(result);
+        BOOST_CHECK_EQUAL(result.rows(), 6);
+        BOOST_CHECK_EQUAL(result.cols(), 0);
+
+        right.resize(0, 2);
+        BOOST_CHECK((compact * right).isZero());
+        BOOST_CHECK_EQUAL((compact * right).rows(), 6);
+
+
+        blocks[1].setRandom(4, 1);
+
+        std::vector<eigenut::DefaultDynamicMatrix> mismatched_blocks(blocks);
+        mismatched_blocks[1].setRandom(2, 2);
+        mismatched_blocks[2].setRandom(2, 4);
+        BOOST_CHECK_THROW(eigenut::makeBlockDiagonal(compact, mismatched_blocks), std::runtime_error);
+
+        eigenut::VariableBlockDiagonalMatrix<> variable;
+        eigenut::makeBlockDiagonal(variable, blocks);
+        dense = eigenut::makeBlockDiagonal(blocks);
+
+        BOOST_CHECK_EQUAL(variable.getNumberOfRows(), 8);
+        BOOST_CHECK_EQUAL(variable.getNumberOfColumns(), 7);
+
+        variable.evaluate(result);
+        BOOST_CHECK(result.isApprox(dense));
+
+        right.setRandom(7, 3);
+        left.setRandom(2, 8);
+        BOOST_CHECK((variable * right).isApprox(dense * right));
+        BOOST_CHECK((left * variable).isApprox(left * dense));
     }
 }